@@ -150,7 +150,7 @@ bool FBINK_RuntimeCodec::Encode(FDecodedAudioStruct DecodedData, FEncodedAudioSt
 #if WITH_RUNTIMEAUDIOIMPORTER_BINK_ENCODE_SUPPORT
 	const uint8 CompressionLevel = GetCompressionLevelFromQualityIndex(Quality);
 
-	int16* TempInt16Buffer;
+	TRuntimeAudioScratchBuffer<int16> TempInt16Buffer;
 	FRAW_RuntimeCodec::TranscodeRAWData<float, int16>(DecodedData.PCMInfo.PCMData.GetView().GetData(), DecodedData.PCMInfo.PCMData.GetView().Num(), TempInt16Buffer);
 	const int64 NumOfSamplesInBytes = DecodedData.PCMInfo.PCMData.GetView().Num() * sizeof(int16);
 
@@ -162,7 +162,7 @@ bool FBINK_RuntimeCodec::Encode(FDecodedAudioStruct DecodedData, FEncodedAudioSt
 	void* CompressedData = nullptr;
 	uint32_t CompressedDataLen = 0;
 
-	UECompressBinkAudio(static_cast<void*>(TempInt16Buffer), NumOfSamplesInBytes, DecodedData.SoundWaveBasicInfo.SampleRate, DecodedData.SoundWaveBasicInfo.NumOfChannels, CompressionLevel, 1,
+	UECompressBinkAudio(static_cast<void*>(TempInt16Buffer.GetData()), NumOfSamplesInBytes, DecodedData.SoundWaveBasicInfo.SampleRate, DecodedData.SoundWaveBasicInfo.NumOfChannels, CompressionLevel, 1,
 #if UE_VERSION_NEWER_THAN(5, 2, 9)
 		MaxSeektableSize,
 #endif
@@ -206,11 +206,14 @@ bool FBINK_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudioSt
 		return false;
 	}
 
-	TArray64<uint8> PCMData;
-
-	// Decompress all the sample data
-	PCMData.Empty(SoundQualityInfo.SampleDataSize);
-	PCMData.AddZeroed(SoundQualityInfo.SampleDataSize);
+	// Decompress all the sample data into a scratch buffer, since it is only needed until transcoded to float
+	TRuntimeAudioScratchBuffer<uint8> PCMData(SoundQualityInfo.SampleDataSize);
+	if (SoundQualityInfo.SampleDataSize > 0 && !PCMData.IsValid())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to allocate memory to decompress the audio data"));
+		return false;
+	}
+	FMemory::Memzero(PCMData.GetData(), PCMData.Num());
 	AudioInfo.ExpandFile(PCMData.GetData(), &SoundQualityInfo);
 
 	// Getting the number of frames
@@ -42,6 +42,8 @@ THIRD_PARTY_INCLUDES_START
 #if PLATFORM_SUPPORTS_VORBIS_CODEC
 #pragma pack(push, 8)
 #include "vorbis/vorbisenc.h"
+#define OV_EXCLUDE_STATIC_CALLBACKS
+#include "vorbis/vorbisfile.h"
 #pragma pack(pop)
 #endif
 #endif
@@ -100,3 +100,87 @@ bool FFLAC_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudioSt
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully decoded FLAC audio data to uncompressed audio format.\nDecoded audio info: %s"), *DecodedData.ToString());
 	return true;
 }
+
+namespace
+{
+	/**
+	 * Stream decoder pulling FLAC audio data from a file through the FLAC decoder's read and seek callbacks
+	 */
+	class FFLAC_RuntimeStreamDecoder : public FBaseRuntimeStreamDecoder
+	{
+	public:
+		explicit FFLAC_RuntimeStreamDecoder(TUniquePtr<IFileHandle>&& InFileHandle)
+			: FBaseRuntimeStreamDecoder(MoveTemp(InFileHandle))
+			, FLAC_Decoder(nullptr)
+		{
+		}
+
+		virtual ~FFLAC_RuntimeStreamDecoder() override
+		{
+			if (FLAC_Decoder)
+			{
+				drflac_close(FLAC_Decoder);
+			}
+		}
+
+		/**
+		 * Initialize the FLAC decoder by parsing the header of the audio data
+		 *
+		 * @return True if the audio data was recognized
+		 */
+		bool Initialize()
+		{
+			FLAC_Decoder = drflac_open(&OnRead, &OnSeek, this, nullptr);
+			return FLAC_Decoder != nullptr;
+		}
+
+		//~ Begin FBaseRuntimeStreamDecoder Interface
+		virtual int64 DecodeFrames(int64 NumOfFrames, float* OutPCMData) override
+		{
+			return static_cast<int64>(drflac_read_pcm_frames_f32(FLAC_Decoder, NumOfFrames, OutPCMData));
+		}
+
+		virtual uint32 GetSampleRate() const override
+		{
+			return FLAC_Decoder->sampleRate;
+		}
+
+		virtual uint32 GetNumOfChannels() const override
+		{
+			return FLAC_Decoder->channels;
+		}
+
+		virtual int64 GetNumOfFrames() const override
+		{
+			return static_cast<int64>(FLAC_Decoder->totalPCMFrameCount);
+		}
+		//~ End FBaseRuntimeStreamDecoder Interface
+
+	private:
+		static size_t OnRead(void* UserData, void* OutData, size_t NumOfBytesToRead)
+		{
+			return static_cast<size_t>(static_cast<FFLAC_RuntimeStreamDecoder*>(UserData)->Read(OutData, NumOfBytesToRead));
+		}
+
+		static drflac_bool32 OnSeek(void* UserData, int Offset, drflac_seek_origin Origin)
+		{
+			return static_cast<FFLAC_RuntimeStreamDecoder*>(UserData)->Seek(Offset, Origin == drflac_seek_origin_current) ? DRFLAC_TRUE : DRFLAC_FALSE;
+		}
+
+		/** FLAC decoder pulling the encoded data through the read and seek callbacks */
+		drflac* FLAC_Decoder;
+	};
+}
+
+TUniquePtr<FBaseRuntimeStreamDecoder> FFLAC_RuntimeCodec::CreateStreamDecoder(TUniquePtr<IFileHandle>&& FileHandle)
+{
+	TUniquePtr<FFLAC_RuntimeStreamDecoder> StreamDecoder = MakeUnique<FFLAC_RuntimeStreamDecoder>(MoveTemp(FileHandle));
+	if (!StreamDecoder->Initialize())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to initialize FLAC stream decoder"));
+		return nullptr;
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully initialized FLAC stream decoder with sample rate %u and %u channels"), StreamDecoder->GetSampleRate(), StreamDecoder->GetNumOfChannels());
+	return MoveTemp(StreamDecoder);
+}
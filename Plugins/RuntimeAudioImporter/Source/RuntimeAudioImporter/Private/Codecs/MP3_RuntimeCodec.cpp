@@ -51,6 +51,164 @@ bool FMP3_RuntimeCodec::GetHeaderInfo(FEncodedAudioStruct EncodedData, FRuntimeA
 	return true;
 }
 
+namespace
+{
+	/** Parsed header of an MPEG audio frame */
+	struct FMP3FrameHeader
+	{
+		bool bMPEG1 = false;
+		int32 Layer = 0;
+		int32 BitRate = 0;
+		int32 SampleRate = 0;
+		int32 NumOfChannels = 0;
+		int32 NumOfSamplesPerFrame = 0;
+		int32 FrameSize = 0;
+	};
+
+	/**
+	 * Parse the 4-byte header of an MPEG audio frame
+	 *
+	 * @param Data Pointer to the frame header
+	 * @param OutHeader Parsed frame header
+	 * @return True if the data is a valid frame header
+	 */
+	bool ParseMP3FrameHeader(const uint8* Data, FMP3FrameHeader& OutHeader)
+	{
+		if (Data[0] != 0xFF || (Data[1] & 0xE0) != 0xE0)
+		{
+			return false;
+		}
+
+		const uint8 VersionBits = (Data[1] >> 3) & 0x03;
+		const uint8 LayerBits = (Data[1] >> 1) & 0x03;
+		const uint8 BitRateIndex = (Data[2] >> 4) & 0x0F;
+		const uint8 SampleRateIndex = (Data[2] >> 2) & 0x03;
+		if (VersionBits == 1 || LayerBits == 0 || BitRateIndex == 0 || BitRateIndex == 15 || SampleRateIndex == 3)
+		{
+			return false;
+		}
+
+		static const int32 BitRates[5][15] = {
+			{0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448}, // MPEG-1 Layer I
+			{0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384}, // MPEG-1 Layer II
+			{0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320}, // MPEG-1 Layer III
+			{0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256}, // MPEG-2/2.5 Layer I
+			{0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160} // MPEG-2/2.5 Layer II and III
+		};
+		static const int32 SampleRates[3] = {44100, 48000, 32000};
+
+		OutHeader.bMPEG1 = VersionBits == 3;
+		OutHeader.Layer = 4 - LayerBits;
+		OutHeader.BitRate = BitRates[OutHeader.bMPEG1 ? OutHeader.Layer - 1 : (OutHeader.Layer == 1 ? 3 : 4)][BitRateIndex] * 1000;
+		OutHeader.SampleRate = SampleRates[SampleRateIndex] >> (VersionBits == 3 ? 0 : VersionBits == 2 ? 1 : 2);
+		OutHeader.NumOfChannels = ((Data[3] >> 6) & 0x03) == 3 ? 1 : 2;
+		OutHeader.NumOfSamplesPerFrame = OutHeader.Layer == 1 ? 384 : (OutHeader.Layer == 3 && !OutHeader.bMPEG1 ? 576 : 1152);
+
+		const int32 Padding = (Data[2] >> 1) & 0x01;
+		OutHeader.FrameSize = OutHeader.Layer == 1
+			                      ? (12 * OutHeader.BitRate / OutHeader.SampleRate + Padding) * 4
+			                      : OutHeader.NumOfSamplesPerFrame / 8 * OutHeader.BitRate / OutHeader.SampleRate + Padding;
+		return true;
+	}
+
+	uint32 ReadBigEndianUInt32(const uint8* Data)
+	{
+		return (static_cast<uint32>(Data[0]) << 24) | (static_cast<uint32>(Data[1]) << 16) | (static_cast<uint32>(Data[2]) << 8) | static_cast<uint32>(Data[3]);
+	}
+}
+
+bool FMP3_RuntimeCodec::GetHeaderInfoFromFile(TUniquePtr<IFileHandle>&& FileHandle, FRuntimeAudioHeaderInfo& HeaderInfo)
+{
+	if (!FileHandle.IsValid())
+	{
+		return false;
+	}
+
+	const int64 FileSize = FileHandle->Size();
+
+	// Skipping the ID3v2 tag, which may be large if it contains pictures
+	int64 AudioDataOffset = 0;
+	TArray64<uint8> HeadData;
+	if (ReadFileRange(*FileHandle, 0, 10, HeadData) && HeadData.Num() == 10 && FMemory::Memcmp(HeadData.GetData(), "ID3", 3) == 0)
+	{
+		AudioDataOffset = 10 + ((HeadData[6] & 0x7F) << 21 | (HeadData[7] & 0x7F) << 14 | (HeadData[8] & 0x7F) << 7 | (HeadData[9] & 0x7F)) + ((HeadData[5] & 0x10) ? 10 : 0);
+	}
+
+	constexpr int64 HeadSize = 16 * 1024;
+	if (!ReadFileRange(*FileHandle, AudioDataOffset, HeadSize, HeadData))
+	{
+		return false;
+	}
+
+	// Finding the first frame, confirmed by the frame following it to avoid false sync words
+	FMP3FrameHeader FrameHeader;
+	int64 FrameOffset = 0;
+	for (; FrameOffset + 4 <= HeadData.Num(); ++FrameOffset)
+	{
+		if (!ParseMP3FrameHeader(HeadData.GetData() + FrameOffset, FrameHeader))
+		{
+			continue;
+		}
+
+		FMP3FrameHeader NextFrameHeader;
+		const int64 NextFrameOffset = FrameOffset + FrameHeader.FrameSize;
+		if (NextFrameOffset + 4 > HeadData.Num() || (ParseMP3FrameHeader(HeadData.GetData() + NextFrameOffset, NextFrameHeader) && NextFrameHeader.SampleRate == FrameHeader.SampleRate))
+		{
+			break;
+		}
+	}
+
+	if (FrameOffset + 4 > HeadData.Num())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to find the first MP3 frame within the first %lld bytes of the audio data"), HeadSize);
+		return false;
+	}
+
+	int64 NumOfFrames = 0;
+
+	// VBR files store the number of frames in a Xing/Info or VBRI header within the first frame
+	{
+		const int64 XingOffset = FrameOffset + 4 + (FrameHeader.bMPEG1 ? (FrameHeader.NumOfChannels == 1 ? 17 : 32) : (FrameHeader.NumOfChannels == 1 ? 9 : 17));
+		const int64 VBRIOffset = FrameOffset + 4 + 32;
+		if (FrameHeader.Layer == 3 && XingOffset + 12 <= HeadData.Num()
+			&& (FMemory::Memcmp(HeadData.GetData() + XingOffset, "Xing", 4) == 0 || FMemory::Memcmp(HeadData.GetData() + XingOffset, "Info", 4) == 0)
+			&& (ReadBigEndianUInt32(HeadData.GetData() + XingOffset + 4) & 0x01))
+		{
+			NumOfFrames = ReadBigEndianUInt32(HeadData.GetData() + XingOffset + 8);
+		}
+		else if (VBRIOffset + 18 <= HeadData.Num() && FMemory::Memcmp(HeadData.GetData() + VBRIOffset, "VBRI", 4) == 0)
+		{
+			NumOfFrames = ReadBigEndianUInt32(HeadData.GetData() + VBRIOffset + 14);
+		}
+	}
+
+	int64 NumOfPCMFrames = NumOfFrames * FrameHeader.NumOfSamplesPerFrame;
+
+	// CBR files are estimated from the size of the audio data, excluding the ID3v1 tag at the end of the file
+	if (NumOfPCMFrames <= 0)
+	{
+		TArray64<uint8> TailData;
+		const bool bHasID3v1Tag = FileSize >= 128 && ReadFileRange(*FileHandle, FileSize - 128, 3, TailData) && FMemory::Memcmp(TailData.GetData(), "TAG", 3) == 0;
+		const int64 AudioDataSize = FileSize - (AudioDataOffset + FrameOffset) - (bHasID3v1Tag ? 128 : 0);
+		NumOfPCMFrames = AudioDataSize * 8 * FrameHeader.SampleRate / FrameHeader.BitRate;
+	}
+
+	if (NumOfPCMFrames <= 0)
+	{
+		return false;
+	}
+
+	{
+		HeaderInfo.Duration = static_cast<float>(NumOfPCMFrames) / FrameHeader.SampleRate;
+		HeaderInfo.NumOfChannels = FrameHeader.NumOfChannels;
+		HeaderInfo.SampleRate = FrameHeader.SampleRate;
+		HeaderInfo.PCMDataSize = NumOfPCMFrames * FrameHeader.NumOfChannels;
+		HeaderInfo.AudioFormat = GetAudioFormat();
+	}
+
+	return true;
+}
+
 bool FMP3_RuntimeCodec::Encode(FDecodedAudioStruct DecodedData, FEncodedAudioStruct& EncodedData, uint8 Quality)
 {
 	ensureMsgf(false, TEXT("MP3 codec does not support encoding at the moment"));
@@ -104,3 +262,85 @@ bool FMP3_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudioStr
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully decoded MP3 audio data to uncompressed audio format.\nDecoded audio info: %s"), *DecodedData.ToString());
 	return true;
 }
+
+namespace
+{
+	/**
+	 * Stream decoder pulling MP3 audio data from a file through the MP3 decoder's read and seek callbacks
+	 */
+	class FMP3_RuntimeStreamDecoder : public FBaseRuntimeStreamDecoder
+	{
+	public:
+		explicit FMP3_RuntimeStreamDecoder(TUniquePtr<IFileHandle>&& InFileHandle)
+			: FBaseRuntimeStreamDecoder(MoveTemp(InFileHandle))
+			, bInitialized(false)
+		{
+		}
+
+		virtual ~FMP3_RuntimeStreamDecoder() override
+		{
+			if (bInitialized)
+			{
+				drmp3_uninit(&MP3_Decoder);
+			}
+		}
+
+		/**
+		 * Initialize the MP3 decoder by parsing the header of the audio data
+		 *
+		 * @return True if the audio data was recognized
+		 */
+		bool Initialize()
+		{
+			bInitialized = drmp3_init(&MP3_Decoder, &OnRead, &OnSeek, this, nullptr) == DRMP3_TRUE;
+			return bInitialized;
+		}
+
+		//~ Begin FBaseRuntimeStreamDecoder Interface
+		virtual int64 DecodeFrames(int64 NumOfFrames, float* OutPCMData) override
+		{
+			return static_cast<int64>(drmp3_read_pcm_frames_f32(&MP3_Decoder, NumOfFrames, OutPCMData));
+		}
+
+		virtual uint32 GetSampleRate() const override
+		{
+			return MP3_Decoder.sampleRate;
+		}
+
+		virtual uint32 GetNumOfChannels() const override
+		{
+			return MP3_Decoder.channels;
+		}
+		//~ End FBaseRuntimeStreamDecoder Interface
+
+	private:
+		static size_t OnRead(void* UserData, void* OutData, size_t NumOfBytesToRead)
+		{
+			return static_cast<size_t>(static_cast<FMP3_RuntimeStreamDecoder*>(UserData)->Read(OutData, NumOfBytesToRead));
+		}
+
+		static drmp3_bool32 OnSeek(void* UserData, int Offset, drmp3_seek_origin Origin)
+		{
+			return static_cast<FMP3_RuntimeStreamDecoder*>(UserData)->Seek(Offset, Origin == drmp3_seek_origin_current) ? DRMP3_TRUE : DRMP3_FALSE;
+		}
+
+		/** MP3 decoder pulling the encoded data through the read and seek callbacks */
+		drmp3 MP3_Decoder;
+
+		/** Whether the MP3 decoder has been initialized */
+		bool bInitialized;
+	};
+}
+
+TUniquePtr<FBaseRuntimeStreamDecoder> FMP3_RuntimeCodec::CreateStreamDecoder(TUniquePtr<IFileHandle>&& FileHandle)
+{
+	TUniquePtr<FMP3_RuntimeStreamDecoder> StreamDecoder = MakeUnique<FMP3_RuntimeStreamDecoder>(MoveTemp(FileHandle));
+	if (!StreamDecoder->Initialize())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to initialize MP3 stream decoder"));
+		return nullptr;
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully initialized MP3 stream decoder with sample rate %u and %u channels"), StreamDecoder->GetSampleRate(), StreamDecoder->GetNumOfChannels());
+	return MoveTemp(StreamDecoder);
+}
@@ -13,87 +13,150 @@
 
 #include "RuntimeAudioImporterDefines.h"
 
-TUniquePtr<FBaseRuntimeCodec> FRuntimeCodecFactory::GetCodec(const FString& FilePath)
+namespace
+{
+	/**
+	 * Get the shared instance of the specified codec. Codecs keep no state between calls, so one instance per codec is enough
+	 */
+	template <typename CodecType>
+	FBaseRuntimeCodec* GetCodecInstance()
+	{
+		static CodecType Codec;
+		return &Codec;
+	}
+
+	/**
+	 * Check whether the audio data contains the specified signature at the given offset
+	 */
+	bool HasSignature(const TArrayView64<uint8>& AudioData, int64 Offset, const char* Signature, int64 SignatureSize)
+	{
+		return AudioData.Num() >= Offset + SignatureSize && FMemory::Memcmp(AudioData.GetData() + Offset, Signature, SignatureSize) == 0;
+	}
+}
+
+FBaseRuntimeCodec* FRuntimeCodecFactory::GetCodec(const FString& FilePath)
 {
 	const FString Extension = FPaths::GetExtension(FilePath, false).ToLower();
 
 	if (Extension == TEXT("mp3"))
 	{
-		return MakeUnique<FMP3_RuntimeCodec>();
+		return GetCodecInstance<FMP3_RuntimeCodec>();
 	}
 	if (Extension == TEXT("wav") || Extension == TEXT("wave"))
 	{
-		return MakeUnique<FWAV_RuntimeCodec>();
+		return GetCodecInstance<FWAV_RuntimeCodec>();
 	}
 	if (Extension == TEXT("flac"))
 	{
-		return MakeUnique<FFLAC_RuntimeCodec>();
+		return GetCodecInstance<FFLAC_RuntimeCodec>();
 	}
 	if (Extension == TEXT("ogg") || Extension == TEXT("oga") || Extension == TEXT("sb0"))
 	{
-		return MakeUnique<FVORBIS_RuntimeCodec>();
+		return GetCodecInstance<FVORBIS_RuntimeCodec>();
 	}
 	if (Extension == TEXT("bink") || Extension == TEXT("binka") || Extension == TEXT("bnk"))
 	{
-		return MakeUnique<FBINK_RuntimeCodec>();
+		return GetCodecInstance<FBINK_RuntimeCodec>();
 	}
 
 	UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Failed to determine the audio codec for '%s' using its file name"), *FilePath);
 	return nullptr;
 }
 
-TUniquePtr<FBaseRuntimeCodec> FRuntimeCodecFactory::GetCodec(ERuntimeAudioFormat AudioFormat)
+FBaseRuntimeCodec* FRuntimeCodecFactory::GetCodec(ERuntimeAudioFormat AudioFormat)
 {
 	switch (AudioFormat)
 	{
 	case ERuntimeAudioFormat::Mp3:
-		return MakeUnique<FMP3_RuntimeCodec>();
+		return GetCodecInstance<FMP3_RuntimeCodec>();
 	case ERuntimeAudioFormat::Wav:
-		return MakeUnique<FWAV_RuntimeCodec>();
+		return GetCodecInstance<FWAV_RuntimeCodec>();
 	case ERuntimeAudioFormat::Flac:
-		return MakeUnique<FFLAC_RuntimeCodec>();
+		return GetCodecInstance<FFLAC_RuntimeCodec>();
 	case ERuntimeAudioFormat::OggVorbis:
-		return MakeUnique<FVORBIS_RuntimeCodec>();
+		return GetCodecInstance<FVORBIS_RuntimeCodec>();
 	case ERuntimeAudioFormat::Bink:
-		return MakeUnique<FBINK_RuntimeCodec>();
+		return GetCodecInstance<FBINK_RuntimeCodec>();
 	default:
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to determine the audio codec for the %s format"), *UEnum::GetValueAsString(AudioFormat));
 		return nullptr;
 	}
 }
 
-TUniquePtr<FBaseRuntimeCodec> FRuntimeCodecFactory::GetCodec(const FRuntimeBulkDataBuffer<uint8>& AudioData)
+FBaseRuntimeCodec* FRuntimeCodecFactory::GetCodec(const FRuntimeBulkDataBuffer<uint8>& AudioData)
+{
+	// Most files can be identified by their signature, which allows to skip probing the other codecs
+	const ERuntimeAudioFormat DetectedAudioFormat = DetectAudioFormatFromSignature(AudioData);
+	if (DetectedAudioFormat != ERuntimeAudioFormat::Invalid)
+	{
+		FBaseRuntimeCodec* DetectedCodec = GetCodec(DetectedAudioFormat);
+		if (DetectedCodec && DetectedCodec->CheckAudioFormat(AudioData))
+		{
+			return DetectedCodec;
+		}
+	}
+
+	// Falling back to probing every codec in turn
+	FBaseRuntimeCodec* const Codecs[] = {
+		GetCodecInstance<FMP3_RuntimeCodec>(),
+		GetCodecInstance<FFLAC_RuntimeCodec>(),
+		GetCodecInstance<FVORBIS_RuntimeCodec>(),
+		GetCodecInstance<FBINK_RuntimeCodec>(),
+		GetCodecInstance<FWAV_RuntimeCodec>()
+	};
+
+	for (FBaseRuntimeCodec* Codec : Codecs)
+	{
+		if (Codec->GetAudioFormat() != DetectedAudioFormat && Codec->CheckAudioFormat(AudioData))
+		{
+			return Codec;
+		}
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to determine the audio codec based on the audio data of size %lld bytes"), static_cast<int64>(AudioData.GetView().Num()));
+	return nullptr;
+}
+
+ERuntimeAudioFormat FRuntimeCodecFactory::DetectAudioFormatFromSignature(const FRuntimeBulkDataBuffer<uint8>& AudioData) const
 {
-	TUniquePtr<FBaseRuntimeCodec> MP3_Codec = MakeUnique<FMP3_RuntimeCodec>();
-	if (MP3_Codec->CheckAudioFormat(AudioData))
+	const TArrayView64<uint8> AudioDataView = AudioData.GetView();
+
+	// RIFF, big-endian RIFX and RF64 containers with the WAVE form type, or Sony Wave64
+	if ((HasSignature(AudioDataView, 0, "RIFF", 4) || HasSignature(AudioDataView, 0, "RIFX", 4) || HasSignature(AudioDataView, 0, "RF64", 4)) && HasSignature(AudioDataView, 8, "WAVE", 4))
 	{
-		return MoveTemp(MP3_Codec);
+		return ERuntimeAudioFormat::Wav;
+	}
+	if (HasSignature(AudioDataView, 0, "riff", 4))
+	{
+		return ERuntimeAudioFormat::Wav;
 	}
 
-	TUniquePtr<FBaseRuntimeCodec> FLAC_Codec = MakeUnique<FFLAC_RuntimeCodec>();
-	if (FLAC_Codec->CheckAudioFormat(AudioData))
+	if (HasSignature(AudioDataView, 0, "fLaC", 4))
 	{
-		return MoveTemp(FLAC_Codec);
+		return ERuntimeAudioFormat::Flac;
 	}
 
-	TUniquePtr<FBaseRuntimeCodec> VORBIS_Codec = MakeUnique<FVORBIS_RuntimeCodec>();
-	if (VORBIS_Codec->CheckAudioFormat(AudioData))
+	if (HasSignature(AudioDataView, 0, "OggS", 4))
 	{
-		return MoveTemp(VORBIS_Codec);
+		return ERuntimeAudioFormat::OggVorbis;
 	}
 
-	TUniquePtr<FBaseRuntimeCodec> BINK_Codec = MakeUnique<FBINK_RuntimeCodec>();
-	if (BINK_Codec->CheckAudioFormat(AudioData))
+	// Bink audio files start with the 'UEBA' tag, stored as a native little-endian 32-bit value
+	if (HasSignature(AudioDataView, 0, "ABEU", 4))
 	{
-		return MoveTemp(BINK_Codec);
+		return ERuntimeAudioFormat::Bink;
 	}
 
-	TUniquePtr<FBaseRuntimeCodec> WAV_Codec = MakeUnique<FWAV_RuntimeCodec>();
-	if (WAV_Codec->CheckAudioFormat(AudioData))
+	if (HasSignature(AudioDataView, 0, "ID3", 3))
 	{
-		return MoveTemp(WAV_Codec);
+		return ERuntimeAudioFormat::Mp3;
 	}
 
-	UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to determine the audio codec based on the audio data of size %lld bytes"), static_cast<int64>(AudioData.GetView().Num()));
-	return nullptr;
+	// MPEG audio frame sync (11 set bits) with a valid layer
+	if (AudioDataView.Num() >= 2 && AudioDataView[0] == 0xFF && (AudioDataView[1] & 0xE0) == 0xE0 && (AudioDataView[1] & 0x06) != 0)
+	{
+		return ERuntimeAudioFormat::Mp3;
+	}
+
+	return ERuntimeAudioFormat::Invalid;
 }
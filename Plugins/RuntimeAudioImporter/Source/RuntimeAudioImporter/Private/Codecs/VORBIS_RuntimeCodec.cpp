@@ -67,6 +67,86 @@ bool FVORBIS_RuntimeCodec::GetHeaderInfo(FEncodedAudioStruct EncodedData, FRunti
 #endif
 }
 
+bool FVORBIS_RuntimeCodec::GetHeaderInfoFromFile(TUniquePtr<IFileHandle>&& FileHandle, FRuntimeAudioHeaderInfo& HeaderInfo)
+{
+	if (!FileHandle.IsValid())
+	{
+		return false;
+	}
+
+	auto ReadLittleEndian = [](const uint8* Data, int32 NumOfBytes)
+	{
+		uint64 Value = 0;
+		for (int32 ByteIndex = NumOfBytes - 1; ByteIndex >= 0; --ByteIndex)
+		{
+			Value = (Value << 8) | Data[ByteIndex];
+		}
+		return Value;
+	};
+
+	// The first Ogg page contains only the Vorbis identification header with the number of channels and the sample rate
+	TArray64<uint8> HeadData;
+	if (!ReadFileRange(*FileHandle, 0, 4 * 1024, HeadData) || HeadData.Num() < 28 || FMemory::Memcmp(HeadData.GetData(), "OggS", 4) != 0)
+	{
+		return false;
+	}
+
+	const uint32 StreamSerialNumber = static_cast<uint32>(ReadLittleEndian(HeadData.GetData() + 14, 4));
+	const int64 PacketOffset = 27 + HeadData[26];
+	if (PacketOffset + 16 > HeadData.Num() || HeadData[PacketOffset] != 0x01 || FMemory::Memcmp(HeadData.GetData() + PacketOffset + 1, "vorbis", 6) != 0)
+	{
+		return false;
+	}
+
+	const int32 NumOfChannels = HeadData[PacketOffset + 11];
+	const int32 SampleRate = static_cast<int32>(ReadLittleEndian(HeadData.GetData() + PacketOffset + 12, 4));
+	if (NumOfChannels <= 0 || SampleRate <= 0)
+	{
+		return false;
+	}
+
+	// The granule position of the last page of the stream is its total number of frames. An Ogg page is at most 65307 bytes, so the tail always contains the start of the last page
+	const int64 FileSize = FileHandle->Size();
+	const int64 TailOffset = FMath::Max<int64>(FileSize - 65307 - 27, 0);
+	TArray64<uint8> TailData;
+	if (!ReadFileRange(*FileHandle, TailOffset, FileSize - TailOffset, TailData))
+	{
+		return false;
+	}
+
+	int64 NumOfFrames = 0;
+	for (int64 PageOffset = TailData.Num() - 27; PageOffset >= 0; --PageOffset)
+	{
+		if (FMemory::Memcmp(TailData.GetData() + PageOffset, "OggS", 4) != 0 || TailData[PageOffset + 4] != 0
+			|| static_cast<uint32>(ReadLittleEndian(TailData.GetData() + PageOffset + 14, 4)) != StreamSerialNumber)
+		{
+			continue;
+		}
+
+		const uint64 GranulePosition = ReadLittleEndian(TailData.GetData() + PageOffset + 6, 8);
+		if (GranulePosition != TNumericLimits<uint64>::Max())
+		{
+			NumOfFrames = static_cast<int64>(GranulePosition);
+			break;
+		}
+	}
+
+	if (NumOfFrames <= 0)
+	{
+		return false;
+	}
+
+	{
+		HeaderInfo.Duration = static_cast<float>(NumOfFrames) / SampleRate;
+		HeaderInfo.NumOfChannels = NumOfChannels;
+		HeaderInfo.SampleRate = SampleRate;
+		HeaderInfo.PCMDataSize = NumOfFrames * NumOfChannels;
+		HeaderInfo.AudioFormat = GetAudioFormat();
+	}
+
+	return true;
+}
+
 bool FVORBIS_RuntimeCodec::Encode(FDecodedAudioStruct DecodedData, FEncodedAudioStruct& EncodedData, uint8 Quality)
 {
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Encoding uncompressed audio data to VORBIS audio format.\nDecoded audio info: %s.\nQuality: %d"), *DecodedData.ToString(), Quality);
@@ -237,6 +317,159 @@ bool FVORBIS_RuntimeCodec::Encode(FDecodedAudioStruct DecodedData, FEncodedAudio
 #endif
 }
 
+#if PLATFORM_SUPPORTS_VORBIS_CODEC
+namespace
+{
+	/**
+	 * Vorbis file decoder decoding directly to interleaved 32-bit float PCM data, without an intermediate 16-bit integer representation
+	 * The encoded data is pulled through the specified callbacks, so the same decoder serves both in-memory and file-backed audio data
+	 */
+	class FVORBIS_FloatDecoder
+	{
+	public:
+		FVORBIS_FloatDecoder()
+			: bInitialized(false)
+		{
+		}
+
+		~FVORBIS_FloatDecoder()
+		{
+			if (bInitialized)
+			{
+				ov_clear(&VorbisFile);
+			}
+		}
+
+		/**
+		 * Open the Vorbis stream by parsing its headers
+		 *
+		 * @param DataSource User data passed to the callbacks
+		 * @param Callbacks Callbacks providing the encoded data
+		 * @return True if the audio data was recognized
+		 */
+		bool Open(void* DataSource, const ov_callbacks& Callbacks)
+		{
+			LoadVorbisLibraries();
+			bInitialized = ov_open_callbacks(DataSource, &VorbisFile, nullptr, 0, Callbacks) == 0;
+			return bInitialized && GetNumOfChannels() > 0 && GetSampleRate() > 0;
+		}
+
+		/**
+		 * Decode the next frames of the stream
+		 *
+		 * @param NumOfFrames Maximum number of frames to decode
+		 * @param OutPCMData Interleaved 32-bit float PCM data with room for NumOfFrames * GetNumOfChannels() samples
+		 * @return The number of decoded frames, less than NumOfFrames at the end of the stream
+		 */
+		int64 DecodeFrames(int64 NumOfFrames, float* OutPCMData)
+		{
+			const int32 NumOfChannels = GetNumOfChannels();
+			int64 NumOfDecodedFrames = 0;
+
+			while (NumOfDecodedFrames < NumOfFrames)
+			{
+				float** PlanarPCMData = nullptr;
+				int32 BitStream = 0;
+				const long NumOfReadFrames = ov_read_float(&VorbisFile, &PlanarPCMData, static_cast<int>(FMath::Min<int64>(NumOfFrames - NumOfDecodedFrames, 4096)), &BitStream);
+
+				// A hole in the data is recoverable, any other error or the end of the stream is not
+				if (NumOfReadFrames == OV_HOLE)
+				{
+					continue;
+				}
+				if (NumOfReadFrames <= 0)
+				{
+					break;
+				}
+
+				float* OutFrame = OutPCMData + NumOfDecodedFrames * NumOfChannels;
+				for (long FrameIndex = 0; FrameIndex < NumOfReadFrames; ++FrameIndex)
+				{
+					for (int32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+					{
+						*OutFrame++ = PlanarPCMData[ChannelIndex][FrameIndex];
+					}
+				}
+
+				NumOfDecodedFrames += NumOfReadFrames;
+			}
+
+			return NumOfDecodedFrames;
+		}
+
+		int32 GetNumOfChannels() const
+		{
+			const vorbis_info* VorbisInfo = ov_info(const_cast<OggVorbis_File*>(&VorbisFile), -1);
+			return VorbisInfo ? VorbisInfo->channels : 0;
+		}
+
+		int32 GetSampleRate() const
+		{
+			const vorbis_info* VorbisInfo = ov_info(const_cast<OggVorbis_File*>(&VorbisFile), -1);
+			return VorbisInfo ? static_cast<int32>(VorbisInfo->rate) : 0;
+		}
+
+		/**
+		 * Retrieve the total number of frames in the stream, or 0 if the stream is not seekable
+		 */
+		int64 GetNumOfFrames() const
+		{
+			const ogg_int64_t NumOfFrames = ov_pcm_total(const_cast<OggVorbis_File*>(&VorbisFile), -1);
+			return NumOfFrames > 0 ? static_cast<int64>(NumOfFrames) : 0;
+		}
+
+	private:
+		/** Vorbis file pulling the encoded data through the callbacks */
+		OggVorbis_File VorbisFile;
+
+		/** Whether the Vorbis file has been opened */
+		bool bInitialized;
+	};
+
+	/**
+	 * In-memory source of encoded Vorbis data for the decoder callbacks
+	 */
+	struct FVORBIS_MemorySource
+	{
+		const uint8* Data;
+		int64 Size;
+		int64 Position;
+
+		static size_t OnRead(void* OutData, size_t ElementSize, size_t NumOfElements, void* UserData)
+		{
+			FVORBIS_MemorySource* Source = static_cast<FVORBIS_MemorySource*>(UserData);
+			const int64 NumOfBytesToRead = FMath::Min<int64>(static_cast<int64>(ElementSize * NumOfElements), Source->Size - Source->Position);
+			if (NumOfBytesToRead <= 0)
+			{
+				return 0;
+			}
+
+			FMemory::Memcpy(OutData, Source->Data + Source->Position, NumOfBytesToRead);
+			Source->Position += NumOfBytesToRead;
+			return static_cast<size_t>(NumOfBytesToRead) / ElementSize;
+		}
+
+		static int OnSeek(void* UserData, ogg_int64_t Offset, int Origin)
+		{
+			FVORBIS_MemorySource* Source = static_cast<FVORBIS_MemorySource*>(UserData);
+			const int64 NewPosition = Origin == SEEK_SET ? Offset : (Origin == SEEK_CUR ? Source->Position + Offset : Source->Size + Offset);
+			if (NewPosition < 0 || NewPosition > Source->Size)
+			{
+				return -1;
+			}
+
+			Source->Position = NewPosition;
+			return 0;
+		}
+
+		static long OnTell(void* UserData)
+		{
+			return static_cast<long>(static_cast<FVORBIS_MemorySource*>(UserData)->Position);
+		}
+	};
+}
+#endif
+
 bool FVORBIS_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudioStruct& DecodedData)
 {
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Decoding VORBIS audio data to uncompressed audio format.\nEncoded audio info: %s"), *EncodedData.ToString());
@@ -244,7 +477,52 @@ bool FVORBIS_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudio
 	ensureAlwaysMsgf(EncodedData.AudioFormat == GetAudioFormat(), TEXT("Attempting to decode audio data using the '%s' codec, but the data format is encoded in '%s'"),
 	                 *UEnum::GetValueAsString(GetAudioFormat()), *UEnum::GetValueAsString(EncodedData.AudioFormat));
 
-#if WITH_OGGVORBIS
+#if PLATFORM_SUPPORTS_VORBIS_CODEC
+	FVORBIS_MemorySource MemorySource{EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), 0};
+	const ov_callbacks Callbacks{&FVORBIS_MemorySource::OnRead, &FVORBIS_MemorySource::OnSeek, nullptr, &FVORBIS_MemorySource::OnTell};
+
+	FVORBIS_FloatDecoder VORBIS_Decoder;
+	if (!VORBIS_Decoder.Open(&MemorySource, Callbacks))
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to initialize VORBIS Decoder"));
+		return false;
+	}
+
+	const int64 PCMFrameCount = VORBIS_Decoder.GetNumOfFrames();
+	const int32 NumOfChannels = VORBIS_Decoder.GetNumOfChannels();
+	const int32 SampleRate = VORBIS_Decoder.GetSampleRate();
+
+	// Allocating memory for PCM data. The data is decoded straight into it, so no intermediate 16-bit integer copy of the whole audio is made
+	float* TempPCMData = PCMFrameCount > 0 ? static_cast<float*>(FMemory::Malloc(PCMFrameCount * NumOfChannels * sizeof(float))) : nullptr;
+	if (!TempPCMData)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate memory for VORBIS Decoder"));
+		return false;
+	}
+
+	// Filling in PCM data and getting the number of frames
+	const int64 NumOfDecodedFrames = VORBIS_Decoder.DecodeFrames(PCMFrameCount, TempPCMData);
+	if (NumOfDecodedFrames <= 0)
+	{
+		FMemory::Free(TempPCMData);
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to decode VORBIS audio data"));
+		return false;
+	}
+
+	DecodedData.PCMInfo.PCMNumOfFrames = static_cast<uint32>(NumOfDecodedFrames);
+	DecodedData.PCMInfo.PCMData = FRuntimeBulkDataBuffer<float>(TempPCMData, NumOfDecodedFrames * NumOfChannels);
+
+	// Getting basic audio information
+	{
+		DecodedData.SoundWaveBasicInfo.Duration = static_cast<float>(NumOfDecodedFrames) / SampleRate;
+		DecodedData.SoundWaveBasicInfo.NumOfChannels = NumOfChannels;
+		DecodedData.SoundWaveBasicInfo.SampleRate = SampleRate;
+		DecodedData.SoundWaveBasicInfo.AudioFormat = GetAudioFormat();
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully decoded VORBIS audio data to uncompressed audio format.\nDecoded audio info: %s"), *DecodedData.ToString());
+	return true;
+#elif WITH_OGGVORBIS
 	FVorbisAudioInfo AudioInfo;
 	FSoundQualityInfo SoundQualityInfo;
 
@@ -255,11 +533,14 @@ bool FVORBIS_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudio
 		return false;
 	}
 
-	TArray64<uint8> PCMData;
-
-	// Decompress all the sample data
-	PCMData.Empty(SoundQualityInfo.SampleDataSize);
-	PCMData.AddZeroed(SoundQualityInfo.SampleDataSize);
+	// Decompress all the sample data into a scratch buffer, since it is only needed until transcoded to float
+	TRuntimeAudioScratchBuffer<uint8> PCMData(SoundQualityInfo.SampleDataSize);
+	if (SoundQualityInfo.SampleDataSize > 0 && !PCMData.IsValid())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to allocate memory to decompress the audio data"));
+		return false;
+	}
+	FMemory::Memzero(PCMData.GetData(), PCMData.Num());
 	AudioInfo.ExpandFile(PCMData.GetData(), &SoundQualityInfo);
 
 	// Getting the number of frames
@@ -286,5 +567,93 @@ bool FVORBIS_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudio
 	return true;
 #else
 	UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Your platform (%hs) does not support VORBIS decoding"), FPlatformProperties::IniPlatformName());
+	return false;
+#endif
+}
+
+#if PLATFORM_SUPPORTS_VORBIS_CODEC
+namespace
+{
+	/**
+	 * Stream decoder pulling Vorbis audio data from a file through the Vorbis decoder's callbacks
+	 */
+	class FVORBIS_RuntimeStreamDecoder : public FBaseRuntimeStreamDecoder
+	{
+	public:
+		explicit FVORBIS_RuntimeStreamDecoder(TUniquePtr<IFileHandle>&& InFileHandle)
+			: FBaseRuntimeStreamDecoder(MoveTemp(InFileHandle))
+		{
+		}
+
+		/**
+		 * Initialize the Vorbis decoder by parsing the headers of the audio data
+		 *
+		 * @return True if the audio data was recognized
+		 */
+		bool Initialize()
+		{
+			const ov_callbacks Callbacks{&OnRead, &OnSeek, nullptr, &OnTell};
+			return VORBIS_Decoder.Open(this, Callbacks);
+		}
+
+		//~ Begin FBaseRuntimeStreamDecoder Interface
+		virtual int64 DecodeFrames(int64 NumOfFrames, float* OutPCMData) override
+		{
+			return VORBIS_Decoder.DecodeFrames(NumOfFrames, OutPCMData);
+		}
+
+		virtual uint32 GetSampleRate() const override
+		{
+			return VORBIS_Decoder.GetSampleRate();
+		}
+
+		virtual uint32 GetNumOfChannels() const override
+		{
+			return VORBIS_Decoder.GetNumOfChannels();
+		}
+
+		virtual int64 GetNumOfFrames() const override
+		{
+			return VORBIS_Decoder.GetNumOfFrames();
+		}
+		//~ End FBaseRuntimeStreamDecoder Interface
+
+	private:
+		static size_t OnRead(void* OutData, size_t ElementSize, size_t NumOfElements, void* UserData)
+		{
+			return static_cast<size_t>(static_cast<FVORBIS_RuntimeStreamDecoder*>(UserData)->Read(OutData, ElementSize * NumOfElements)) / ElementSize;
+		}
+
+		static int OnSeek(void* UserData, ogg_int64_t Offset, int Origin)
+		{
+			FVORBIS_RuntimeStreamDecoder* StreamDecoder = static_cast<FVORBIS_RuntimeStreamDecoder*>(UserData);
+			const bool bSucceeded = Origin == SEEK_END ? StreamDecoder->Seek(StreamDecoder->GetFileSize() + Offset, false) : StreamDecoder->Seek(Offset, Origin == SEEK_CUR);
+			return bSucceeded ? 0 : -1;
+		}
+
+		static long OnTell(void* UserData)
+		{
+			return static_cast<long>(static_cast<FVORBIS_RuntimeStreamDecoder*>(UserData)->GetFilePosition());
+		}
+
+		/** Vorbis decoder pulling the encoded data through the callbacks */
+		FVORBIS_FloatDecoder VORBIS_Decoder;
+	};
+}
+#endif
+
+TUniquePtr<FBaseRuntimeStreamDecoder> FVORBIS_RuntimeCodec::CreateStreamDecoder(TUniquePtr<IFileHandle>&& FileHandle)
+{
+#if PLATFORM_SUPPORTS_VORBIS_CODEC
+	TUniquePtr<FVORBIS_RuntimeStreamDecoder> StreamDecoder = MakeUnique<FVORBIS_RuntimeStreamDecoder>(MoveTemp(FileHandle));
+	if (!StreamDecoder->Initialize())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to initialize VORBIS stream decoder"));
+		return nullptr;
+	}
+
+	return StreamDecoder;
+#else
+	return nullptr;
 #endif
 }
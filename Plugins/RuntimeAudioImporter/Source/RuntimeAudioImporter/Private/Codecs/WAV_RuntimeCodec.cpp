@@ -13,10 +13,24 @@
 namespace
 {
 	/**
-	 * Check and fix the WAV audio data with the correct byte size in the RIFF container
+	 * Locations of the RIFF container size fields left unset (hex FFFFFFFF), e.g. by an unfinalized recording
+	 */
+	struct FWavDurationErrors
+	{
+		int64 FileSizeLocation = INDEX_NONE;
+		int64 DataSizeLocation = INDEX_NONE;
+
+		bool HasErrors() const
+		{
+			return FileSizeLocation != INDEX_NONE || DataSizeLocation != INDEX_NONE;
+		}
+	};
+
+	/**
+	 * Find the incorrectly set byte sizes in the RIFF container of the WAV audio data, without modifying it
 	 * Made by https://github.com/kass-kass
 	 */
-	bool CheckAndFixWavDurationErrors(const FRuntimeBulkDataBuffer<uint8>& WavData)
+	bool FindWavDurationErrors(const FRuntimeBulkDataBuffer<uint8>& WavData, FWavDurationErrors& DurationErrors)
 	{
 		drwav WAV;
 
@@ -27,20 +41,20 @@ namespace
 			return false;
 		}
 
+		const bool bRIFFContainer = WAV.container == drwav_container_riff;
+		drwav_uninit(&WAV);
+
 		// Check if the container is RIFF (not Wave64 or any other containers)
-		if (WAV.container != drwav_container_riff)
+		if (!bRIFFContainer)
 		{
-			drwav_uninit(&WAV);
 			return true;
 		}
 
 		// Get 4-byte field at byte 4, which is the overall file size as uint32, according to RIFF specification.
-		// If the field is set to nothing (hex FFFFFFFF), replace the incorrectly set field with the actual size.
-		// The field should be (size of file - 8 bytes), as the chunk identifier for the whole file (4 bytes spelling out RIFF at the start of the file), and the chunk length (4 bytes that we're replacing) are excluded.
+		// If the field is set to nothing (hex FFFFFFFF), it has to be replaced with the actual size.
 		if (BytesToHex(WavData.GetView().GetData() + 4, 4) == "FFFFFFFF")
 		{
-			const int32 ActualFileSize = WavData.GetView().Num() - 8;
-			FMemory::Memcpy(WavData.GetView().GetData() + 4, &ActualFileSize, 4);
+			DurationErrors.FileSizeLocation = 4;
 		}
 
 		// Search for the place in the file after the chunk id "data", which is where the data length is stored.
@@ -59,20 +73,55 @@ namespace
 		// Should never happen, but just in case
 		if (DataSizeLocation == INDEX_NONE)
 		{
-			drwav_uninit(&WAV);
 			return false;
 		}
 
-		// Same process as replacing full file size, except DataSize counts bytes from end of DataSize int to end of file.
 		if (BytesToHex(WavData.GetView().GetData() + DataSizeLocation, 4) == "FFFFFFFF")
 		{
-			// -4 to not include the DataSize int itself
-			const uint32 ActualDataSize = WavData.GetView().Num() - DataSizeLocation - 4;
+			DurationErrors.DataSizeLocation = DataSizeLocation;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Check and fix the WAV audio data with the correct byte size in the RIFF container
+	 * The audio data is copied into an owned allocation before being fixed if it wraps external memory, which may be read-only (e.g. a memory-mapped file)
+	 */
+	bool CheckAndFixWavDurationErrors(FRuntimeBulkDataBuffer<uint8>& WavData)
+	{
+		FWavDurationErrors DurationErrors;
+		if (!FindWavDurationErrors(WavData, DurationErrors))
+		{
+			return false;
+		}
 
-			FMemory::Memcpy(WavData.GetView().GetData() + DataSizeLocation, &ActualDataSize, 4);
+		if (!DurationErrors.HasErrors())
+		{
+			return true;
+		}
+
+		if (WavData.IsExternal() && !WavData.MakeOwned())
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate memory to fix WAV audio data duration error"));
+			return false;
+		}
+
+		// The field should be (size of file - 8 bytes), as the chunk identifier for the whole file (4 bytes spelling out RIFF at the start of the file), and the chunk length (4 bytes that we're replacing) are excluded.
+		if (DurationErrors.FileSizeLocation != INDEX_NONE)
+		{
+			const int32 ActualFileSize = WavData.GetView().Num() - 8;
+			FMemory::Memcpy(WavData.GetView().GetData() + DurationErrors.FileSizeLocation, &ActualFileSize, 4);
+		}
+
+		// Same process as replacing full file size, except DataSize counts bytes from end of DataSize int to end of file.
+		if (DurationErrors.DataSizeLocation != INDEX_NONE)
+		{
+			// -4 to not include the DataSize int itself
+			const uint32 ActualDataSize = WavData.GetView().Num() - DurationErrors.DataSizeLocation - 4;
+			FMemory::Memcpy(WavData.GetView().GetData() + DurationErrors.DataSizeLocation, &ActualDataSize, 4);
 		}
 
-		drwav_uninit(&WAV);
 		return true;
 	}
 }
@@ -81,9 +130,22 @@ bool FWAV_RuntimeCodec::CheckAudioFormat(const FRuntimeBulkDataBuffer<uint8>& Au
 {
 	drwav WAV;
 
-	CheckAndFixWavDurationErrors(AudioData);
+	// The audio data cannot be modified here, so the duration errors are fixed in a copy, which is only made if there are any
+	FRuntimeBulkDataBuffer<uint8> FixedAudioData;
+	const FRuntimeBulkDataBuffer<uint8>* AudioDataToCheck = &AudioData;
+	{
+		FWavDurationErrors DurationErrors;
+		if (FindWavDurationErrors(AudioData, DurationErrors) && DurationErrors.HasErrors())
+		{
+			FixedAudioData = AudioData;
+			if (CheckAndFixWavDurationErrors(FixedAudioData))
+			{
+				AudioDataToCheck = &FixedAudioData;
+			}
+		}
+	}
 
-	if (!drwav_init_memory(&WAV, AudioData.GetView().GetData(), AudioData.GetView().Num(), nullptr))
+	if (!drwav_init_memory(&WAV, AudioDataToCheck->GetView().GetData(), AudioDataToCheck->GetView().Num(), nullptr))
 	{
 		return false;
 	}
@@ -143,12 +205,11 @@ bool FWAV_RuntimeCodec::Encode(FDecodedAudioStruct DecodedData, FEncodedAudioStr
 		return false;
 	}
 
-	int16* TempInt16BBuffer;
-	FRAW_RuntimeCodec::TranscodeRAWData<float, int16>(DecodedData.PCMInfo.PCMData.GetView().GetData(), DecodedData.PCMInfo.PCMData.GetView().Num(), TempInt16BBuffer);
+	TRuntimeAudioScratchBuffer<int16> TempInt16Buffer;
+	FRAW_RuntimeCodec::TranscodeRAWData<float, int16>(DecodedData.PCMInfo.PCMData.GetView().GetData(), DecodedData.PCMInfo.PCMData.GetView().Num(), TempInt16Buffer);
 
-	drwav_write_pcm_frames(&WAV_Encoder, DecodedData.PCMInfo.PCMNumOfFrames, TempInt16BBuffer);
+	drwav_write_pcm_frames(&WAV_Encoder, DecodedData.PCMInfo.PCMNumOfFrames, TempInt16Buffer.GetData());
 	drwav_uninit(&WAV_Encoder);
-	FMemory::Free(TempInt16BBuffer);
 
 	// Populating the encoded audio data
 	{
@@ -210,3 +271,90 @@ bool FWAV_RuntimeCodec::Decode(FEncodedAudioStruct EncodedData, FDecodedAudioStr
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully decoded WAV audio data to uncompressed audio format.\nDecoded audio info: %s"), *DecodedData.ToString());
 	return true;
 }
+
+namespace
+{
+	/**
+	 * Stream decoder pulling WAV audio data from a file through the WAV decoder's read and seek callbacks
+	 */
+	class FWAV_RuntimeStreamDecoder : public FBaseRuntimeStreamDecoder
+	{
+	public:
+		explicit FWAV_RuntimeStreamDecoder(TUniquePtr<IFileHandle>&& InFileHandle)
+			: FBaseRuntimeStreamDecoder(MoveTemp(InFileHandle))
+			, bInitialized(false)
+		{
+		}
+
+		virtual ~FWAV_RuntimeStreamDecoder() override
+		{
+			if (bInitialized)
+			{
+				drwav_uninit(&WAV_Decoder);
+			}
+		}
+
+		/**
+		 * Initialize the WAV decoder by parsing the header of the audio data
+		 *
+		 * @return True if the audio data was recognized
+		 */
+		bool Initialize()
+		{
+			bInitialized = drwav_init(&WAV_Decoder, &OnRead, &OnSeek, this, nullptr) == DRWAV_TRUE;
+			return bInitialized;
+		}
+
+		//~ Begin FBaseRuntimeStreamDecoder Interface
+		virtual int64 DecodeFrames(int64 NumOfFrames, float* OutPCMData) override
+		{
+			return static_cast<int64>(drwav_read_pcm_frames_f32(&WAV_Decoder, NumOfFrames, OutPCMData));
+		}
+
+		virtual uint32 GetSampleRate() const override
+		{
+			return WAV_Decoder.sampleRate;
+		}
+
+		virtual uint32 GetNumOfChannels() const override
+		{
+			return WAV_Decoder.channels;
+		}
+
+		virtual int64 GetNumOfFrames() const override
+		{
+			return static_cast<int64>(WAV_Decoder.totalPCMFrameCount);
+		}
+		//~ End FBaseRuntimeStreamDecoder Interface
+
+	private:
+		static size_t OnRead(void* UserData, void* OutData, size_t NumOfBytesToRead)
+		{
+			return static_cast<size_t>(static_cast<FWAV_RuntimeStreamDecoder*>(UserData)->Read(OutData, NumOfBytesToRead));
+		}
+
+		static drwav_bool32 OnSeek(void* UserData, int Offset, drwav_seek_origin Origin)
+		{
+			return static_cast<FWAV_RuntimeStreamDecoder*>(UserData)->Seek(Offset, Origin == drwav_seek_origin_current) ? DRWAV_TRUE : DRWAV_FALSE;
+		}
+
+		/** WAV decoder pulling the encoded data through the read and seek callbacks */
+		drwav WAV_Decoder;
+
+		/** Whether the WAV decoder has been initialized */
+		bool bInitialized;
+	};
+}
+
+TUniquePtr<FBaseRuntimeStreamDecoder> FWAV_RuntimeCodec::CreateStreamDecoder(TUniquePtr<IFileHandle>&& FileHandle)
+{
+	TUniquePtr<FWAV_RuntimeStreamDecoder> StreamDecoder = MakeUnique<FWAV_RuntimeStreamDecoder>(MoveTemp(FileHandle));
+	if (!StreamDecoder->Initialize())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to initialize WAV stream decoder"));
+		return nullptr;
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully initialized WAV stream decoder with sample rate %u and %u channels"), StreamDecoder->GetSampleRate(), StreamDecoder->GetNumOfChannels());
+	return MoveTemp(StreamDecoder);
+}
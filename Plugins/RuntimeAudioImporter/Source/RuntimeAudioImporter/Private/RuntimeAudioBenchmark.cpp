@@ -0,0 +1,292 @@
+﻿// Georgy Treshchev 2024.
+
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+#include "RuntimeAudioScratchPool.h"
+#include "Codecs/BaseRuntimeCodec.h"
+#include "Codecs/RAW_RuntimeCodec.h"
+#include "Codecs/RuntimeCodecFactory.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	/** Result of a single benchmarked operation */
+	struct FRuntimeAudioBenchmarkResult
+	{
+		FString Name;
+		bool bSucceeded = false;
+		double ElapsedSeconds = 0;
+		double AudioSeconds = 0;
+		int64 NumOfPCMBytes = 0;
+		int64 PeakMemoryBytes = 0;
+	};
+
+	/**
+	 * Measure an operation processing the specified amount of audio
+	 *
+	 * @param Name Name of the operation to report
+	 * @param AudioSeconds Duration of the processed audio, used for the realtime factor
+	 * @param NumOfPCMBytes Size of the processed 32-bit float PCM data, used for the throughput
+	 * @param Operation Operation to measure, returning whether it succeeded
+	 */
+	FRuntimeAudioBenchmarkResult MeasureOperation(const FString& Name, double AudioSeconds, int64 NumOfPCMBytes, TFunctionRef<bool()> Operation)
+	{
+		FRuntimeAudioBenchmarkResult Result;
+		Result.Name = Name;
+		Result.AudioSeconds = AudioSeconds;
+		Result.NumOfPCMBytes = NumOfPCMBytes;
+
+		// The process-wide memory high-water mark only moves if the operation exceeds it, so the memory still held right after the operation is taken into account as well
+		const FPlatformMemoryStats MemoryStatsBefore = FPlatformMemory::GetStats();
+		const double StartTime = FPlatformTime::Seconds();
+		Result.bSucceeded = Operation();
+		Result.ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+		const FPlatformMemoryStats MemoryStatsAfter = FPlatformMemory::GetStats();
+
+		const int64 PeakUsedPhysicalIncrease = static_cast<int64>(MemoryStatsAfter.PeakUsedPhysical) - static_cast<int64>(MemoryStatsBefore.PeakUsedPhysical);
+		const int64 UsedPhysicalIncrease = static_cast<int64>(MemoryStatsAfter.UsedPhysical) - static_cast<int64>(MemoryStatsBefore.UsedPhysical);
+		Result.PeakMemoryBytes = FMath::Max3<int64>(0, PeakUsedPhysicalIncrease, UsedPhysicalIncrease);
+		return Result;
+	}
+
+	/**
+	 * Generate a synthetic signal: a different tone per channel with a slow frequency sweep and some noise, so codecs cannot compress it trivially
+	 */
+	FDecodedAudioStruct GenerateSignal(double Seconds, int32 SampleRate, int32 NumOfChannels)
+	{
+		const int64 NumOfFrames = static_cast<int64>(Seconds * SampleRate);
+		float* PCMData = static_cast<float*>(FMemory::Malloc(NumOfFrames * NumOfChannels * sizeof(float)));
+
+		FRandomStream RandomStream(1234);
+		for (int64 FrameIndex = 0; FrameIndex < NumOfFrames; ++FrameIndex)
+		{
+			const double Time = static_cast<double>(FrameIndex) / SampleRate;
+			for (int32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+			{
+				const double Frequency = 220.0 * (ChannelIndex + 1) + 100.0 * FMath::Sin(Time * 0.5);
+				PCMData[FrameIndex * NumOfChannels + ChannelIndex] = static_cast<float>(0.5 * FMath::Sin(2.0 * PI * Frequency * Time) + 0.05 * RandomStream.FRandRange(-1.f, 1.f));
+			}
+		}
+
+		FDecodedAudioStruct Signal;
+		Signal.PCMInfo.PCMData = FRuntimeBulkDataBuffer<float>(PCMData, NumOfFrames * NumOfChannels);
+		Signal.PCMInfo.PCMNumOfFrames = static_cast<uint32>(NumOfFrames);
+		Signal.SoundWaveBasicInfo.Duration = static_cast<float>(Seconds);
+		Signal.SoundWaveBasicInfo.NumOfChannels = NumOfChannels;
+		Signal.SoundWaveBasicInfo.SampleRate = SampleRate;
+		return Signal;
+	}
+
+	/**
+	 * Whether the codec of the specified format can encode on this platform, so encoded input can be generated for it
+	 */
+	bool CanEncode(ERuntimeAudioFormat AudioFormat)
+	{
+		switch (AudioFormat)
+		{
+		case ERuntimeAudioFormat::Wav:
+			return true;
+		case ERuntimeAudioFormat::OggVorbis:
+			return PLATFORM_SUPPORTS_VORBIS_CODEC;
+		case ERuntimeAudioFormat::Bink:
+			return WITH_RUNTIMEAUDIOIMPORTER_BINK_ENCODE_SUPPORT;
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * Run the benchmark and log the results
+	 *
+	 * @param Seconds Duration of the synthetic signal, in seconds
+	 * @param MinRealtimeFactor Minimum realtime factor each operation must reach
+	 * @param SampleFilePaths Audio files to additionally measure the decoding of
+	 * @param OutFailures Descriptions of the operations that failed or were below the minimum realtime factor
+	 * @return Whether all operations succeeded and reached the minimum realtime factor
+	 */
+	bool RunRuntimeAudioBenchmark(double Seconds, double MinRealtimeFactor, const TArray<FString>& SampleFilePaths, TArray<FString>& OutFailures)
+	{
+		constexpr int32 SampleRate = 44100;
+		constexpr int32 NumOfChannels = 2;
+
+		const FDecodedAudioStruct Signal = GenerateSignal(Seconds, SampleRate, NumOfChannels);
+		const int64 NumOfSamples = Signal.PCMInfo.PCMData.GetView().Num();
+		const int64 NumOfPCMBytes = NumOfSamples * sizeof(float);
+
+		TArray<FRuntimeAudioBenchmarkResult> Results;
+		FRuntimeCodecFactory CodecFactory;
+
+		// Encoding and decoding the synthetic signal with every codec able to produce its own input
+		for (ERuntimeAudioFormat AudioFormat : {ERuntimeAudioFormat::Wav, ERuntimeAudioFormat::Mp3, ERuntimeAudioFormat::Flac, ERuntimeAudioFormat::OggVorbis, ERuntimeAudioFormat::Bink})
+		{
+			const FString FormatName = UEnum::GetDisplayValueAsText(AudioFormat).ToString();
+			FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(AudioFormat);
+			if (!RuntimeCodec || !CanEncode(AudioFormat))
+			{
+				UE_LOG(LogRuntimeAudioImporter, Display, TEXT("RuntimeAudioImporter benchmark: skipping %s, it has no encoder on this platform to generate its input (pass sample files to measure its decoding)"), *FormatName);
+				continue;
+			}
+
+			FEncodedAudioStruct EncodedData;
+			{
+				FDecodedAudioStruct EncoderInput = Signal;
+				Results.Add(MeasureOperation(FormatName + TEXT(" encode"), Seconds, NumOfPCMBytes, [RuntimeCodec, &EncoderInput, &EncodedData]()
+				{
+					return RuntimeCodec->Encode(MoveTemp(EncoderInput), EncodedData, 70);
+				}));
+			}
+
+			FDecodedAudioStruct DecodedData;
+			Results.Add(MeasureOperation(FormatName + TEXT(" decode"), Seconds, NumOfPCMBytes, [RuntimeCodec, &EncodedData, &DecodedData]()
+			{
+				return RuntimeCodec->Decode(MoveTemp(EncodedData), DecodedData);
+			}));
+		}
+
+		// Decoding the sample files, which covers the codecs without an encoder
+		for (const FString& SampleFilePath : SampleFilePaths)
+		{
+			FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(SampleFilePath);
+			TArray64<uint8> AudioData;
+			if (!RuntimeCodec || !RuntimeAudioImporter::LoadAudioFileToArray(AudioData, SampleFilePath))
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("RuntimeAudioImporter benchmark: unable to load the sample file '%s'"), *SampleFilePath);
+				OutFailures.Add(FString::Printf(TEXT("Unable to load the sample file '%s'"), *SampleFilePath));
+				continue;
+			}
+
+			FEncodedAudioStruct EncodedData(AudioData, RuntimeCodec->GetAudioFormat());
+			AudioData.Empty();
+
+			FDecodedAudioStruct DecodedData;
+			FRuntimeAudioBenchmarkResult Result = MeasureOperation(FPaths::GetCleanFilename(SampleFilePath) + TEXT(" decode"), 0, 0, [RuntimeCodec, &EncodedData, &DecodedData]()
+			{
+				return RuntimeCodec->Decode(MoveTemp(EncodedData), DecodedData);
+			});
+			Result.AudioSeconds = DecodedData.SoundWaveBasicInfo.Duration;
+			Result.NumOfPCMBytes = DecodedData.PCMInfo.PCMData.GetView().Num() * sizeof(float);
+			Results.Add(MoveTemp(Result));
+		}
+
+		// RAW helpers
+		{
+			Audio::FAlignedFloatBuffer SourcePCMData(Signal.PCMInfo.PCMData.GetView().GetData(), static_cast<int32>(NumOfSamples));
+
+			Audio::FAlignedFloatBuffer ResampledPCMData;
+			Results.Add(MeasureOperation(TEXT("ResampleRAWData 44.1k->48k"), Seconds, NumOfPCMBytes, [&SourcePCMData, &ResampledPCMData]()
+			{
+				return FRAW_RuntimeCodec::ResampleRAWData(SourcePCMData, NumOfChannels, SampleRate, 48000, ResampledPCMData);
+			}));
+			ResampledPCMData.Empty();
+
+			Audio::FAlignedFloatBuffer MixedPCMData;
+			Results.Add(MeasureOperation(TEXT("MixChannelsRAWData 2->1"), Seconds, NumOfPCMBytes, [&SourcePCMData, &MixedPCMData]()
+			{
+				return FRAW_RuntimeCodec::MixChannelsRAWData(SourcePCMData, SampleRate, NumOfChannels, 1, MixedPCMData);
+			}));
+
+			Audio::FAlignedFloatBuffer UpmixedPCMData;
+			Results.Add(MeasureOperation(TEXT("MixChannelsRAWData 1->2"), Seconds, MixedPCMData.Num() * sizeof(float), [&MixedPCMData, &UpmixedPCMData]()
+			{
+				return FRAW_RuntimeCodec::MixChannelsRAWData(MixedPCMData, SampleRate, 1, NumOfChannels, UpmixedPCMData);
+			}));
+			MixedPCMData.Empty();
+			UpmixedPCMData.Empty();
+
+			int16* Int16PCMData = nullptr;
+			Results.Add(MeasureOperation(TEXT("TranscodeRAWData float->int16"), Seconds, NumOfPCMBytes, [&SourcePCMData, NumOfSamples, &Int16PCMData]()
+			{
+				FRAW_RuntimeCodec::TranscodeRAWData<float, int16>(SourcePCMData.GetData(), NumOfSamples, Int16PCMData);
+				return Int16PCMData != nullptr;
+			}));
+
+			float* FloatPCMData = nullptr;
+			Results.Add(MeasureOperation(TEXT("TranscodeRAWData int16->float"), Seconds, NumOfPCMBytes, [&Int16PCMData, NumOfSamples, &FloatPCMData]()
+			{
+				FRAW_RuntimeCodec::TranscodeRAWData<int16, float>(Int16PCMData, NumOfSamples, FloatPCMData);
+				return FloatPCMData != nullptr;
+			}));
+
+			FMemory::Free(Int16PCMData);
+			FMemory::Free(FloatPCMData);
+		}
+
+		UE_LOG(LogRuntimeAudioImporter, Display, TEXT("RuntimeAudioImporter benchmark: %.1f s of %d Hz audio with %d channels (%.2f MB of PCM data)"), Seconds, SampleRate, NumOfChannels, NumOfPCMBytes / (1024.0 * 1024.0));
+
+		for (const FRuntimeAudioBenchmarkResult& Result : Results)
+		{
+			const double MegabytesPerSecond = Result.NumOfPCMBytes / (1024.0 * 1024.0) / FMath::Max(Result.ElapsedSeconds, 1e-9);
+			const double RealtimeFactor = Result.AudioSeconds / FMath::Max(Result.ElapsedSeconds, 1e-9);
+			const bool bPassed = Result.bSucceeded && RealtimeFactor >= MinRealtimeFactor;
+			if (!bPassed)
+			{
+				OutFailures.Add(!Result.bSucceeded
+					? FString::Printf(TEXT("%s failed"), *Result.Name)
+					: FString::Printf(TEXT("%s ran at %.1fx realtime, below the minimum of %.1fx"), *Result.Name, RealtimeFactor, MinRealtimeFactor));
+			}
+
+			UE_LOG(LogRuntimeAudioImporter, Display, TEXT("  %-32s %9.3f ms %9.1f MB/s %9.1fx realtime, peak memory +%.2f MB%s"),
+			       *Result.Name, Result.ElapsedSeconds * 1000, MegabytesPerSecond, RealtimeFactor, Result.PeakMemoryBytes / (1024.0 * 1024.0),
+			       !Result.bSucceeded ? TEXT(" (failed)") : (bPassed ? TEXT("") : TEXT(" (below the minimum realtime factor)")));
+		}
+
+		UE_LOG(LogRuntimeAudioImporter, Display, TEXT("RuntimeAudioImporter benchmark: scratch buffer pool %s"), *FRuntimeAudioScratchPool::Get().GetStats().ToString());
+
+		return OutFailures.Num() == 0;
+	}
+
+	void RunRuntimeAudioBenchmarkCommand(const TArray<FString>& Args)
+	{
+		const double Seconds = Args.Num() > 0 ? FMath::Max(1.0, FCString::Atod(*Args[0])) : 30.0;
+		const double MinRealtimeFactor = Args.Num() > 1 ? FCString::Atod(*Args[1]) : 0.0;
+		const TArray<FString> SampleFilePaths = Args.Num() > 2 ? TArray<FString>(Args.GetData() + 2, Args.Num() - 2) : TArray<FString>();
+
+		TArray<FString> Failures;
+		if (!RunRuntimeAudioBenchmark(Seconds, MinRealtimeFactor, SampleFilePaths, Failures))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("RuntimeAudioImporter benchmark: %d operations failed or were below %.1fx realtime"), Failures.Num(), MinRealtimeFactor);
+		}
+	}
+}
+
+static FAutoConsoleCommand GRuntimeAudioBenchmarkCommand(
+	TEXT("RuntimeAudioImporter.Benchmark"),
+	TEXT("Encodes and decodes a synthetic signal with every codec, runs the RAW helpers and logs throughput, realtime factor and peak memory to LogRuntimeAudioImporter.\n")
+	TEXT("Operations failing or running below MinRealtimeFactor are logged as errors. For a gate that fails the run, use the RuntimeAudioImporter.Performance.Benchmark automation test instead.\n")
+	TEXT("Usage: RuntimeAudioImporter.Benchmark [Seconds=30] [MinRealtimeFactor=0] [SampleFilePath...]\n")
+	TEXT("Headless: -nullrhi -ExecCmds=\"RuntimeAudioImporter.Benchmark, Quit\""),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RunRuntimeAudioBenchmarkCommand));
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Regression gate for the benchmark, failing if any operation fails or runs slower than realtime
+ * Headless: -nullrhi -ExecCmds="Automation RunTests RuntimeAudioImporter.Performance.Benchmark; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterBenchmarkTest, "RuntimeAudioImporter.Performance.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FRuntimeAudioImporterBenchmarkTest::RunTest(const FString& Parameters)
+{
+	constexpr double Seconds = 10.0;
+	constexpr double MinRealtimeFactor = 1.0;
+
+	TArray<FString> Failures;
+	RunRuntimeAudioBenchmark(Seconds, MinRealtimeFactor, TArray<FString>(), Failures);
+	for (const FString& Failure : Failures)
+	{
+		AddError(Failure);
+	}
+
+	return Failures.Num() == 0;
+}
+
+#endif
+
+#endif
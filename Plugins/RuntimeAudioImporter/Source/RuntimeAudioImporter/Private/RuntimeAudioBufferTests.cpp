@@ -0,0 +1,331 @@
+﻿// Georgy Treshchev 2024.
+
+#include "RuntimeAudioImporterTypes.h"
+#include "RuntimeAudioDecodedCache.h"
+#include "RuntimeAudioScratchPool.h"
+
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterPCMRingBufferTest, "RuntimeAudioImporter.Buffers.PCMRingBuffer", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterPCMRingBufferTest::RunTest(const FString& Parameters)
+{
+	// Wrapping around the end of the storage within a single push and a single pop
+	{
+		FRuntimePCMRingBuffer RingBuffer;
+		RingBuffer.Initialize(8);
+		TestEqual(TEXT("The capacity is the requested number of samples"), RingBuffer.GetCapacity(), 8u);
+
+		float Samples[12];
+		for (int32 SampleIndex = 0; SampleIndex < 12; ++SampleIndex)
+		{
+			Samples[SampleIndex] = static_cast<float>(SampleIndex);
+		}
+
+		float PoppedSamples[8];
+		TestEqual(TEXT("The first push fits"), RingBuffer.Push(Samples, 6), 6u);
+		TestEqual(TEXT("The first pop reads the oldest samples"), RingBuffer.Pop(PoppedSamples, 4), 4u);
+		TestEqual(TEXT("The first popped sample is the first pushed one"), PoppedSamples[0], 0.f);
+
+		TestEqual(TEXT("The wrapping push fits"), RingBuffer.Push(Samples + 6, 6), 6u);
+		TestEqual(TEXT("The buffer is full"), RingBuffer.Num(), 8u);
+		TestEqual(TEXT("Nothing is pushed into a full buffer"), RingBuffer.Push(Samples, 1), 0u);
+
+		TestEqual(TEXT("The wrapping pop reads all samples"), RingBuffer.Pop(PoppedSamples, 8), 8u);
+		for (int32 SampleIndex = 0; SampleIndex < 8; ++SampleIndex)
+		{
+			TestEqual(FString::Printf(TEXT("Sample %d is read in order across the wrap-around"), SampleIndex), PoppedSamples[SampleIndex], static_cast<float>(SampleIndex + 4));
+		}
+		TestEqual(TEXT("The buffer is empty"), RingBuffer.Num(), 0u);
+	}
+
+	// A producer thread and a consumer thread passing a sequence through a buffer much smaller than the sequence
+	{
+		constexpr uint32 NumOfSamples = 1 << 18;
+		FRuntimePCMRingBuffer RingBuffer;
+		RingBuffer.Initialize(64);
+
+		TFuture<void> Producer = Async(EAsyncExecution::Thread, [&RingBuffer]()
+		{
+			float Chunk[37];
+			uint32 NumOfPushedSamples = 0;
+			while (NumOfPushedSamples < NumOfSamples)
+			{
+				const uint32 NumOfChunkSamples = FMath::Min<uint32>(1 + NumOfPushedSamples % 37, NumOfSamples - NumOfPushedSamples);
+				for (uint32 SampleIndex = 0; SampleIndex < NumOfChunkSamples; ++SampleIndex)
+				{
+					Chunk[SampleIndex] = static_cast<float>(NumOfPushedSamples + SampleIndex);
+				}
+
+				const uint32 NumOfPushedChunkSamples = RingBuffer.Push(Chunk, NumOfChunkSamples);
+				NumOfPushedSamples += NumOfPushedChunkSamples;
+				if (NumOfPushedChunkSamples == 0)
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+		});
+
+		float Chunk[29];
+		uint32 NumOfPoppedSamples = 0;
+		uint32 NumOfMisorderedSamples = 0;
+		while (NumOfPoppedSamples < NumOfSamples)
+		{
+			const uint32 NumOfPoppedChunkSamples = RingBuffer.Pop(Chunk, 1 + NumOfPoppedSamples % 29);
+			for (uint32 SampleIndex = 0; SampleIndex < NumOfPoppedChunkSamples; ++SampleIndex)
+			{
+				NumOfMisorderedSamples += Chunk[SampleIndex] != static_cast<float>(NumOfPoppedSamples + SampleIndex) ? 1 : 0;
+			}
+
+			NumOfPoppedSamples += NumOfPoppedChunkSamples;
+			if (NumOfPoppedChunkSamples == 0)
+			{
+				FPlatformProcess::Yield();
+			}
+		}
+
+		Producer.Wait();
+		TestEqual(TEXT("Every sample passes between the threads in order"), NumOfMisorderedSamples, 0u);
+		TestEqual(TEXT("The buffer is empty once the consumer is done"), RingBuffer.Num(), 0u);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterBulkDataBufferTest, "RuntimeAudioImporter.Buffers.BulkDataBuffer", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterBulkDataBufferTest::RunTest(const FString& Parameters)
+{
+	auto TestSequence = [this](const TCHAR* What, const FRuntimeBulkDataBuffer<float>& Buffer, int32 FirstValue, int32 NumOfValues)
+	{
+		if (!TestEqual(FString::Printf(TEXT("%s: number of elements"), What), static_cast<int32>(Buffer.GetView().Num()), NumOfValues))
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < NumOfValues; ++Index)
+		{
+			if (Buffer.GetView()[Index] != static_cast<float>(FirstValue + Index))
+			{
+				AddError(FString::Printf(TEXT("%s: element %d is %f, expected %d"), What, Index, Buffer.GetView()[Index], FirstValue + Index));
+				return;
+			}
+		}
+	};
+
+	// Appending, releasing from the start, compacting with shrinking, and appending again
+	{
+		FRuntimeBulkDataBuffer<float> Buffer;
+		for (int32 ChunkIndex = 0; ChunkIndex < 10; ++ChunkIndex)
+		{
+			float Chunk[10];
+			for (int32 Index = 0; Index < 10; ++Index)
+			{
+				Chunk[Index] = static_cast<float>(ChunkIndex * 10 + Index);
+			}
+			TestTrue(TEXT("A chunk is appended"), Buffer.Append(Chunk, 10));
+		}
+		TestSequence(TEXT("Appended chunks"), Buffer, 0, 100);
+		const int64 GrownCapacity = Buffer.GetCapacity();
+
+		Buffer.RemoveFromStart(30);
+		TestSequence(TEXT("Released without compaction"), Buffer, 30, 70);
+
+		// The released space now exceeds the remaining elements, so they are compacted and the oversized allocation is shrunk
+		Buffer.RemoveFromStart(50);
+		TestSequence(TEXT("Released with compaction"), Buffer, 80, 20);
+		TestTrue(TEXT("The allocation is shrunk after most elements are released"), Buffer.GetCapacity() >= 20 && Buffer.GetCapacity() < GrownCapacity);
+
+		float Chunk[20];
+		for (int32 Index = 0; Index < 20; ++Index)
+		{
+			Chunk[Index] = static_cast<float>(100 + Index);
+		}
+		TestTrue(TEXT("Appending after releasing succeeds"), Buffer.Append(Chunk, 20));
+		TestSequence(TEXT("Appended after releasing"), Buffer, 80, 40);
+
+		Buffer.RemoveFromStart(Buffer.GetView().Num());
+		TestEqual(TEXT("Releasing everything empties the buffer"), static_cast<int32>(Buffer.GetView().Num()), 0);
+		TestTrue(TEXT("Appending to an emptied buffer succeeds"), Buffer.Append(Chunk, 20));
+		TestSequence(TEXT("Appended after releasing everything"), Buffer, 100, 20);
+	}
+
+	// External memory is never written to, and is released once the buffer takes its own copy
+	{
+		float ExternalData[8];
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			ExternalData[Index] = static_cast<float>(Index);
+		}
+
+		bool bExternalDataReleased = false;
+		FRuntimeBulkDataBuffer<float> Buffer(ExternalData, 8, [&bExternalDataReleased]()
+		{
+			bExternalDataReleased = true;
+		});
+		TestTrue(TEXT("The buffer wraps the external memory"), Buffer.IsExternal());
+
+		Buffer.RemoveFromStart(2);
+		TestFalse(TEXT("Releasing from the start keeps the external memory"), bExternalDataReleased);
+		TestSequence(TEXT("External memory released from the start"), Buffer, 2, 6);
+
+		const float AppendedValue = 8.f;
+		TestTrue(TEXT("Appending to external memory succeeds"), Buffer.Append(&AppendedValue, 1));
+		TestFalse(TEXT("The buffer owns its memory after appending"), Buffer.IsExternal());
+		TestTrue(TEXT("The external memory is released after appending"), bExternalDataReleased);
+		TestSequence(TEXT("External memory released from the start and appended to"), Buffer, 2, 7);
+		TestEqual(TEXT("The external memory is left unmodified"), ExternalData[7], 7.f);
+	}
+
+	{
+		float ExternalData[4] = {0.f, 1.f, 2.f, 3.f};
+		bool bExternalDataReleased = false;
+		FRuntimeBulkDataBuffer<float> Buffer(ExternalData, 4, [&bExternalDataReleased]()
+		{
+			bExternalDataReleased = true;
+		});
+
+		TestTrue(TEXT("The external memory is copied"), Buffer.MakeOwned());
+		TestFalse(TEXT("The buffer owns its memory"), Buffer.IsExternal());
+		TestTrue(TEXT("The external memory is released once copied"), bExternalDataReleased);
+		TestTrue(TEXT("The copy is separate from the external memory"), Buffer.GetView().GetData() != ExternalData);
+		TestSequence(TEXT("Owned copy of the external memory"), Buffer, 0, 4);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterDecodedCacheTest, "RuntimeAudioImporter.Buffers.DecodedCacheEviction", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterDecodedCacheTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumOfEntrySamples = 1000;
+	constexpr int64 EntrySizeInBytes = NumOfEntrySamples * sizeof(float);
+
+	auto MakeEntry = []()
+	{
+		TArray<float> Samples;
+		Samples.SetNumZeroed(NumOfEntrySamples);
+
+		FRuntimeAudioDecodedCache::FEntry Entry;
+		Entry.PCMInfo = MakeShared<FPCMStruct>();
+		Entry.PCMInfo->PCMData = FRuntimeBulkDataBuffer<float>(Samples);
+		Entry.PCMInfo->PCMNumOfFrames = NumOfEntrySamples;
+		return Entry;
+	};
+
+	// The cache is process-wide, so its budget is restored afterwards. Shrinking the budget evicts whatever else is cached
+	FRuntimeAudioDecodedCache& Cache = FRuntimeAudioDecodedCache::Get();
+	const int64 OriginalBudgetBytes = Cache.GetStats().BudgetBytes;
+	Cache.SetBudget(0);
+	Cache.SetBudget(EntrySizeInBytes * 3);
+	Cache.ResetStats();
+
+	const FString KeyA = TEXT("Test|DecodedCacheEviction|A");
+	const FString KeyB = TEXT("Test|DecodedCacheEviction|B");
+	const FString KeyC = TEXT("Test|DecodedCacheEviction|C");
+	const FString KeyD = TEXT("Test|DecodedCacheEviction|D");
+
+	Cache.Add(KeyA, MakeEntry());
+	Cache.Add(KeyB, MakeEntry());
+	Cache.Add(KeyC, MakeEntry());
+	TestEqual(TEXT("Three entries fit in the budget"), Cache.GetStats().NumOfEntries, 3);
+
+	// Using A makes B the least recently used entry
+	FRuntimeAudioDecodedCache::FEntry FoundEntry;
+	TestTrue(TEXT("A is found"), Cache.Find(KeyA, FoundEntry));
+
+	Cache.Add(KeyD, MakeEntry());
+	TestFalse(TEXT("The least recently used entry is evicted"), Cache.Find(KeyB, FoundEntry));
+	TestTrue(TEXT("The recently used entry is kept"), Cache.Find(KeyA, FoundEntry));
+	TestTrue(TEXT("C is kept"), Cache.Find(KeyC, FoundEntry));
+	TestTrue(TEXT("The added entry is kept"), Cache.Find(KeyD, FoundEntry));
+
+	const FRuntimeAudioCacheStats Stats = Cache.GetStats();
+	TestEqual(TEXT("One entry is evicted"), Stats.NumOfEvictions, static_cast<int64>(1));
+	TestEqual(TEXT("The cached data fits in the budget"), Stats.UsedBytes, EntrySizeInBytes * 3);
+
+	// Data larger than the whole budget is not cached, and does not evict anything
+	{
+		FRuntimeAudioDecodedCache::FEntry LargeEntry = MakeEntry();
+		TArray<float> LargeSamples;
+		LargeSamples.SetNumZeroed(NumOfEntrySamples * 4);
+		LargeEntry.PCMInfo->PCMData = FRuntimeBulkDataBuffer<float>(LargeSamples);
+		Cache.Add(TEXT("Test|DecodedCacheEviction|Large"), LargeEntry);
+		TestEqual(TEXT("Data larger than the budget is not cached"), Cache.GetStats().NumOfEntries, 3);
+	}
+
+	Cache.SetBudget(0);
+	TestEqual(TEXT("A zero budget releases all entries"), Cache.GetStats().NumOfEntries, 0);
+	Cache.SetBudget(OriginalBudgetBytes);
+	Cache.ResetStats();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterScratchPoolTest, "RuntimeAudioImporter.Buffers.ScratchPoolBudget", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterScratchPoolTest::RunTest(const FString& Parameters)
+{
+	constexpr int64 BufferSize = 64 * 1024;
+
+	// The pool is process-wide, so its budget is restored afterwards
+	FRuntimeAudioScratchPool& Pool = FRuntimeAudioScratchPool::Get();
+	const int64 OriginalBudgetBytes = Pool.GetStats().BudgetBytes;
+	Pool.SetBudget(0);
+	Pool.SetBudget(BufferSize * 2);
+	Pool.ResetStats();
+
+	// Only as many buffers as fit in the budget are retained, the rest is freed
+	{
+		int64 Capacities[3];
+		void* Buffers[3];
+		for (int32 BufferIndex = 0; BufferIndex < 3; ++BufferIndex)
+		{
+			Buffers[BufferIndex] = Pool.Acquire(BufferSize, Capacities[BufferIndex]);
+			TestNotNull(TEXT("A buffer is acquired"), Buffers[BufferIndex]);
+			TestEqual(TEXT("The buffer has the size of its size class"), Capacities[BufferIndex], BufferSize);
+		}
+		for (int32 BufferIndex = 0; BufferIndex < 3; ++BufferIndex)
+		{
+			Pool.Release(Buffers[BufferIndex], Capacities[BufferIndex]);
+		}
+
+		const FRuntimeAudioScratchPoolStats Stats = Pool.GetStats();
+		TestEqual(TEXT("Two buffers are retained"), Stats.NumOfRetainedBuffers, 2);
+		TestEqual(TEXT("The retained memory fits in the budget"), Stats.RetainedBytes, BufferSize * 2);
+		TestEqual(TEXT("The buffer exceeding the budget is freed"), Stats.NumOfDiscards, static_cast<int64>(1));
+	}
+
+	// A retained buffer is reused
+	{
+		int64 Capacity;
+		void* Buffer = Pool.Acquire(BufferSize, Capacity);
+		TestEqual(TEXT("The retained buffer is reused"), Pool.GetStats().NumOfHits, static_cast<int64>(1));
+		Pool.Release(Buffer, Capacity);
+	}
+
+	// A buffer larger than the budget bypasses the pool with its exact size
+	{
+		constexpr int64 LargeBufferSize = BufferSize * 3 + 1;
+		int64 Capacity;
+		void* Buffer = Pool.Acquire(LargeBufferSize, Capacity);
+		TestEqual(TEXT("A buffer larger than the budget is not rounded up"), Capacity, LargeBufferSize);
+		Pool.Release(Buffer, Capacity);
+		TestEqual(TEXT("A buffer larger than the budget is not retained"), Pool.GetStats().RetainedBytes, BufferSize * 2);
+	}
+
+	Pool.SetBudget(BufferSize);
+	TestEqual(TEXT("Shrinking the budget frees the retained buffers exceeding it"), Pool.GetStats().RetainedBytes, BufferSize);
+
+	Pool.SetBudget(OriginalBudgetBytes);
+	Pool.ResetStats();
+
+	return true;
+}
+
+#endif
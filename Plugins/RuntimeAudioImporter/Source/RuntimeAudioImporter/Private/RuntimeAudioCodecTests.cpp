@@ -0,0 +1,236 @@
+﻿// Georgy Treshchev 2024.
+
+#include "RuntimeAudioImporterTypes.h"
+#include "Codecs/RAW_RuntimeCodec.h"
+#include "Codecs/RuntimeCodecFactory.h"
+#include "Codecs/WAV_RuntimeCodec.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/**
+	 * Build a 16-bit PCM WAV file whose RIFF and data chunk sizes are left unset (hex FFFFFFFF), as written by a recording that was never finalized
+	 */
+	TArray<uint8> MakeWavWithUnsetSizes(int32 NumOfFrames, int32 NumOfChannels, int32 SampleRate)
+	{
+		TArray<uint8> WavData;
+		auto WriteBytes = [&WavData](const void* Bytes, int32 NumOfBytes)
+		{
+			WavData.Append(static_cast<const uint8*>(Bytes), NumOfBytes);
+		};
+		auto WriteUInt32 = [&WriteBytes](uint32 Value)
+		{
+			const uint8 Bytes[4] = {static_cast<uint8>(Value), static_cast<uint8>(Value >> 8), static_cast<uint8>(Value >> 16), static_cast<uint8>(Value >> 24)};
+			WriteBytes(Bytes, 4);
+		};
+		auto WriteUInt16 = [&WriteBytes](uint16 Value)
+		{
+			const uint8 Bytes[2] = {static_cast<uint8>(Value), static_cast<uint8>(Value >> 8)};
+			WriteBytes(Bytes, 2);
+		};
+
+		WriteBytes("RIFF", 4);
+		WriteUInt32(0xFFFFFFFF);
+		WriteBytes("WAVEfmt ", 8);
+		WriteUInt32(16);
+		WriteUInt16(1);
+		WriteUInt16(NumOfChannels);
+		WriteUInt32(SampleRate);
+		WriteUInt32(SampleRate * NumOfChannels * sizeof(int16));
+		WriteUInt16(NumOfChannels * sizeof(int16));
+		WriteUInt16(16);
+		WriteBytes("data", 4);
+		WriteUInt32(0xFFFFFFFF);
+
+		for (int32 SampleIndex = 0; SampleIndex < NumOfFrames * NumOfChannels; ++SampleIndex)
+		{
+			WriteUInt16(static_cast<uint16>(static_cast<int16>((SampleIndex % 64 - 32) * 512)));
+		}
+
+		return WavData;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterWavUnsetSizesTest, "RuntimeAudioImporter.Codecs.WavUnsetSizesFromFile", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterWavUnsetSizesTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumOfFrames = 1000;
+	constexpr int32 NumOfChannels = 2;
+	constexpr int32 SampleRate = 44100;
+
+	const TArray<uint8> WavData = MakeWavWithUnsetSizes(NumOfFrames, NumOfChannels, SampleRate);
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RuntimeAudioImporterUnsetSizes.wav"));
+	if (!TestTrue(TEXT("The test WAV file is written"), FFileHelper::SaveArrayToFile(WavData, *FilePath)))
+	{
+		return false;
+	}
+
+	{
+		// The file is memory-mapped where supported, which is read-only and must not be written to when fixing the sizes
+		FRuntimeBulkDataBuffer<uint8> AudioData;
+		if (TestTrue(TEXT("The WAV file is loaded"), RuntimeAudioImporter::LoadAudioFileToBulkData(AudioData, FilePath)))
+		{
+			AddInfo(AudioData.IsExternal() ? TEXT("The WAV file is memory-mapped") : TEXT("The WAV file is read into memory, memory mapping is not supported on this platform"));
+
+			FWAV_RuntimeCodec WavCodec;
+			TestTrue(TEXT("The WAV format is recognized"), WavCodec.CheckAudioFormat(AudioData));
+
+			FDecodedAudioStruct DecodedData;
+			if (TestTrue(TEXT("The WAV file is decoded"), WavCodec.Decode(FEncodedAudioStruct(MoveTemp(AudioData), ERuntimeAudioFormat::Wav), DecodedData)))
+			{
+				TestEqual(TEXT("All frames are decoded"), static_cast<int32>(DecodedData.PCMInfo.PCMNumOfFrames), NumOfFrames);
+				TestEqual(TEXT("The number of channels is decoded"), DecodedData.SoundWaveBasicInfo.NumOfChannels, NumOfChannels);
+				TestEqual(TEXT("The sample rate is decoded"), DecodedData.SoundWaveBasicInfo.SampleRate, SampleRate);
+				TestEqual(TEXT("The first sample is decoded"), DecodedData.PCMInfo.PCMData.GetView()[0], -0.5f);
+			}
+		}
+	}
+
+	TArray<uint8> FileDataAfterDecoding;
+	if (TestTrue(TEXT("The WAV file is read back"), FFileHelper::LoadFileToArray(FileDataAfterDecoding, *FilePath)))
+	{
+		TestTrue(TEXT("The WAV file is left unmodified"), FileDataAfterDecoding == WavData);
+	}
+
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterSignatureDetectionTest, "RuntimeAudioImporter.Codecs.SignatureDetection", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterSignatureDetectionTest::RunTest(const FString& Parameters)
+{
+	FRuntimeCodecFactory CodecFactory;
+
+	auto DetectAudioFormat = [&CodecFactory](const char* Header, int32 NumOfHeaderBytes)
+	{
+		// Padded, so that only the signature decides the format
+		TArray<uint8> AudioData(reinterpret_cast<const uint8*>(Header), NumOfHeaderBytes);
+		AudioData.AddZeroed(FMath::Max(0, 16 - NumOfHeaderBytes));
+		return CodecFactory.DetectAudioFormatFromSignature(FRuntimeBulkDataBuffer<uint8>(AudioData));
+	};
+
+	TestEqual(TEXT("RIFF WAVE is detected as WAV"), DetectAudioFormat("RIFF\0\0\0\0WAVE", 12), ERuntimeAudioFormat::Wav);
+	TestEqual(TEXT("RIFX WAVE is detected as WAV"), DetectAudioFormat("RIFX\0\0\0\0WAVE", 12), ERuntimeAudioFormat::Wav);
+	TestEqual(TEXT("RF64 WAVE is detected as WAV"), DetectAudioFormat("RF64\0\0\0\0WAVE", 12), ERuntimeAudioFormat::Wav);
+	TestEqual(TEXT("Wave64 is detected as WAV"), DetectAudioFormat("riff", 4), ERuntimeAudioFormat::Wav);
+	TestEqual(TEXT("RIFF without the WAVE form type is not detected"), DetectAudioFormat("RIFF\0\0\0\0AVI ", 12), ERuntimeAudioFormat::Invalid);
+	TestEqual(TEXT("fLaC is detected as FLAC"), DetectAudioFormat("fLaC", 4), ERuntimeAudioFormat::Flac);
+	TestEqual(TEXT("OggS is detected as OGG Vorbis"), DetectAudioFormat("OggS", 4), ERuntimeAudioFormat::OggVorbis);
+	TestEqual(TEXT("The Bink audio tag is detected as Bink"), DetectAudioFormat("ABEU", 4), ERuntimeAudioFormat::Bink);
+	TestEqual(TEXT("An ID3 tag is detected as MP3"), DetectAudioFormat("ID3", 3), ERuntimeAudioFormat::Mp3);
+	TestEqual(TEXT("An MPEG frame sync is detected as MP3"), DetectAudioFormat("\xFF\xFB", 2), ERuntimeAudioFormat::Mp3);
+	TestEqual(TEXT("An MPEG frame sync with a reserved layer is not detected"), DetectAudioFormat("\xFF\xF9", 2), ERuntimeAudioFormat::Invalid);
+	TestEqual(TEXT("Unknown data is not detected"), DetectAudioFormat("junkjunk", 8), ERuntimeAudioFormat::Invalid);
+	TestEqual(TEXT("Empty data is not detected"), CodecFactory.DetectAudioFormatFromSignature(FRuntimeBulkDataBuffer<uint8>()), ERuntimeAudioFormat::Invalid);
+	{
+		const TArray<uint8> TruncatedData = {'R', 'I', 'F'};
+		TestEqual(TEXT("A truncated signature is not detected"), CodecFactory.DetectAudioFormatFromSignature(FRuntimeBulkDataBuffer<uint8>(TruncatedData)), ERuntimeAudioFormat::Invalid);
+	}
+
+	// A complete file is handed to the codec matching its signature
+	{
+		const FRuntimeBulkDataBuffer<uint8> WavData(MakeWavWithUnsetSizes(100, 1, 16000));
+		FBaseRuntimeCodec* Codec = CodecFactory.GetCodec(WavData);
+		if (TestNotNull(TEXT("A codec is found for the WAV data"), Codec))
+		{
+			TestEqual(TEXT("The WAV codec is found for the WAV data"), Codec->GetAudioFormat(), ERuntimeAudioFormat::Wav);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterStreamingResamplerTest, "RuntimeAudioImporter.Codecs.StreamingResampler", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterStreamingResamplerTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumOfFrames = 4800;
+	constexpr int32 SourceSampleRate = 48000;
+	constexpr int32 SourceNumOfChannels = 2;
+
+	TArray<float> PCMData;
+	PCMData.SetNumUninitialized(NumOfFrames * SourceNumOfChannels);
+	for (int32 FrameIndex = 0; FrameIndex < NumOfFrames; ++FrameIndex)
+	{
+		PCMData[FrameIndex * SourceNumOfChannels] = FMath::Sin(2 * PI * 440 * FrameIndex / SourceSampleRate) * 0.5f;
+		PCMData[FrameIndex * SourceNumOfChannels + 1] = FMath::Sin(2 * PI * 1000 * FrameIndex / SourceSampleRate) * 0.25f;
+	}
+
+	struct FConversion
+	{
+		int32 DestinationSampleRate;
+		int32 DestinationNumOfChannels;
+		ERuntimeResamplingQuality Quality;
+	};
+
+	const FConversion Conversions[] = {
+		{44100, 2, ERuntimeResamplingQuality::BestSinc},
+		{44100, 2, ERuntimeResamplingQuality::Linear},
+		{22050, 1, ERuntimeResamplingQuality::SincFast},
+		{96000, 1, ERuntimeResamplingQuality::BestSinc}
+	};
+
+	// Uneven chunk sizes, so that chunk boundaries fall at arbitrary positions within the resampling filter
+	const int32 ChunkNumOfFrames[] = {1, 7, 64, 333, 1000, 19, 512};
+
+	for (const FConversion& Conversion : Conversions)
+	{
+		const FString ConversionName = FString::Printf(TEXT("%d Hz %d channels to %d Hz %d channels"), SourceSampleRate, SourceNumOfChannels, Conversion.DestinationSampleRate, Conversion.DestinationNumOfChannels);
+
+		Audio::FAlignedFloatBuffer OneShotPCMData;
+		{
+			FRuntimeStreamingResampler Resampler;
+			if (!TestTrue(FString::Printf(TEXT("%s: the whole stream is converted at once"), *ConversionName), Resampler.ProcessChunk(PCMData.GetData(), PCMData.Num(), SourceSampleRate, SourceNumOfChannels, Conversion.DestinationSampleRate, Conversion.DestinationNumOfChannels, Conversion.Quality, OneShotPCMData, true)))
+			{
+				continue;
+			}
+		}
+
+		TArray<float> ChunkedPCMData;
+		{
+			FRuntimeStreamingResampler Resampler;
+			Audio::FAlignedFloatBuffer ConvertedChunk;
+			int32 FrameIndex = 0;
+			for (int32 ChunkIndex = 0; FrameIndex < NumOfFrames; ++ChunkIndex)
+			{
+				const int32 NumOfChunkFrames = FMath::Min(ChunkNumOfFrames[ChunkIndex % UE_ARRAY_COUNT(ChunkNumOfFrames)], NumOfFrames - FrameIndex);
+				if (!TestTrue(FString::Printf(TEXT("%s: a chunk is converted"), *ConversionName), Resampler.ProcessChunk(PCMData.GetData() + FrameIndex * SourceNumOfChannels, NumOfChunkFrames * SourceNumOfChannels, SourceSampleRate, SourceNumOfChannels, Conversion.DestinationSampleRate, Conversion.DestinationNumOfChannels, Conversion.Quality, ConvertedChunk)))
+				{
+					break;
+				}
+				ChunkedPCMData.Append(ConvertedChunk.GetData(), ConvertedChunk.Num());
+				FrameIndex += NumOfChunkFrames;
+			}
+
+			TestTrue(FString::Printf(TEXT("%s: frames are held back until the end of the stream"), *ConversionName), Resampler.IsResampling());
+			if (TestTrue(FString::Printf(TEXT("%s: the held back frames are flushed"), *ConversionName), Resampler.Flush(ConvertedChunk)))
+			{
+				ChunkedPCMData.Append(ConvertedChunk.GetData(), ConvertedChunk.Num());
+			}
+		}
+
+		if (!TestEqual(FString::Printf(TEXT("%s: the chunked stream has as many samples as the whole stream"), *ConversionName), ChunkedPCMData.Num(), OneShotPCMData.Num()))
+		{
+			continue;
+		}
+
+		float MaxDifference = 0.f;
+		for (int32 SampleIndex = 0; SampleIndex < OneShotPCMData.Num(); ++SampleIndex)
+		{
+			MaxDifference = FMath::Max(MaxDifference, FMath::Abs(ChunkedPCMData[SampleIndex] - OneShotPCMData[SampleIndex]));
+		}
+		TestTrue(FString::Printf(TEXT("%s: the chunked stream matches the whole stream (max difference %f)"), *ConversionName, MaxDifference), MaxDifference <= 1e-4f);
+	}
+
+	return true;
+}
+
+#endif
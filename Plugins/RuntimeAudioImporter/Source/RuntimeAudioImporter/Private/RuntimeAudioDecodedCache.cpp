@@ -0,0 +1,153 @@
+﻿// Georgy Treshchev 2024.
+
+#include "RuntimeAudioDecodedCache.h"
+
+#include "RuntimeAudioImporterDefines.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/Paths.h"
+
+FRuntimeAudioDecodedCache& FRuntimeAudioDecodedCache::Get()
+{
+	static FRuntimeAudioDecodedCache Instance;
+	return Instance;
+}
+
+void FRuntimeAudioDecodedCache::SetBudget(int64 InBudgetBytes)
+{
+	FRAIScopeLock Lock(&DataGuard);
+	BudgetBytes = FMath::Max<int64>(InBudgetBytes, 0);
+	EvictToBudget_Internal();
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Decoded audio cache budget set to %lld bytes"), BudgetBytes);
+}
+
+bool FRuntimeAudioDecodedCache::IsEnabled() const
+{
+	FRAIScopeLock Lock(&DataGuard);
+	return BudgetBytes > 0;
+}
+
+FString FRuntimeAudioDecodedCache::MakeFileKey(const FString& FilePath, ERuntimeAudioFormat AudioFormat)
+{
+	const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+	if (FileSize < 0)
+	{
+		return FString();
+	}
+
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*FilePath);
+	return FString::Printf(TEXT("File|%s|%lld|%lld|%d"), *FPaths::ConvertRelativePathToFull(FilePath), TimeStamp.GetTicks(), FileSize, static_cast<int32>(AudioFormat));
+}
+
+FString FRuntimeAudioDecodedCache::MakeContentKey(const uint8* AudioData, int64 NumOfBytes, ERuntimeAudioFormat AudioFormat)
+{
+	// CityHash64 takes a 32-bit length, so the data is hashed in chunks, each seeded with the hash of the previous ones
+	constexpr int64 MaxChunkSize = 1 << 30;
+	uint64 Hash = 0;
+	for (int64 Offset = 0; Offset < NumOfBytes; Offset += MaxChunkSize)
+	{
+		const uint32 ChunkSize = static_cast<uint32>(FMath::Min<int64>(MaxChunkSize, NumOfBytes - Offset));
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(AudioData + Offset), ChunkSize, Hash);
+	}
+
+	return FString::Printf(TEXT("Content|%016llx|%lld|%d"), Hash, NumOfBytes, static_cast<int32>(AudioFormat));
+}
+
+bool FRuntimeAudioDecodedCache::Find(const FString& Key, FEntry& OutEntry)
+{
+	FRAIScopeLock Lock(&DataGuard);
+	FCachedEntry* CachedEntry = Entries.Find(Key);
+	if (!CachedEntry)
+	{
+		++NumOfMisses;
+		return false;
+	}
+
+	++NumOfHits;
+	CachedEntry->LastAccess = ++AccessCounter;
+	OutEntry = CachedEntry->Entry;
+	return true;
+}
+
+void FRuntimeAudioDecodedCache::Add(const FString& Key, const FEntry& Entry)
+{
+	if (!Entry.PCMInfo.IsValid())
+	{
+		return;
+	}
+
+	const int64 SizeInBytes = static_cast<int64>(Entry.PCMInfo->PCMData.GetView().Num()) * sizeof(float);
+
+	FRAIScopeLock Lock(&DataGuard);
+	if (SizeInBytes > BudgetBytes)
+	{
+		return;
+	}
+
+	if (const FCachedEntry* ExistingEntry = Entries.Find(Key))
+	{
+		UsedBytes -= ExistingEntry->SizeInBytes;
+	}
+
+	FCachedEntry& CachedEntry = Entries.Add(Key);
+	CachedEntry.Entry = Entry;
+	CachedEntry.SizeInBytes = SizeInBytes;
+	CachedEntry.LastAccess = ++AccessCounter;
+	UsedBytes += SizeInBytes;
+
+	EvictToBudget_Internal();
+}
+
+void FRuntimeAudioDecodedCache::Empty()
+{
+	FRAIScopeLock Lock(&DataGuard);
+	Entries.Empty();
+	UsedBytes = 0;
+}
+
+FRuntimeAudioCacheStats FRuntimeAudioDecodedCache::GetStats() const
+{
+	FRAIScopeLock Lock(&DataGuard);
+	FRuntimeAudioCacheStats Stats;
+	Stats.NumOfHits = NumOfHits;
+	Stats.NumOfMisses = NumOfMisses;
+	Stats.NumOfEvictions = NumOfEvictions;
+	Stats.NumOfEntries = Entries.Num();
+	Stats.UsedBytes = UsedBytes;
+	Stats.BudgetBytes = BudgetBytes;
+	return Stats;
+}
+
+void FRuntimeAudioDecodedCache::ResetStats()
+{
+	FRAIScopeLock Lock(&DataGuard);
+	NumOfHits = 0;
+	NumOfMisses = 0;
+	NumOfEvictions = 0;
+}
+
+void FRuntimeAudioDecodedCache::EvictToBudget_Internal()
+{
+	while (UsedBytes > BudgetBytes && Entries.Num() > 0)
+	{
+		// Map iterators cannot be reassigned, so the least recently used entry is tracked by its key
+		const FString* LeastRecentKey = nullptr;
+		uint64 LeastRecentAccess = TNumericLimits<uint64>::Max();
+		int64 LeastRecentSizeInBytes = 0;
+		for (const TPair<FString, FCachedEntry>& CachedEntry : Entries)
+		{
+			if (CachedEntry.Value.LastAccess < LeastRecentAccess)
+			{
+				LeastRecentKey = &CachedEntry.Key;
+				LeastRecentAccess = CachedEntry.Value.LastAccess;
+				LeastRecentSizeInBytes = CachedEntry.Value.SizeInBytes;
+			}
+		}
+
+		// Copy the key, since removing the entry destroys the one it points to
+		const FString KeyToRemove = *LeastRecentKey;
+		Entries.Remove(KeyToRemove);
+		UsedBytes -= LeastRecentSizeInBytes;
+		++NumOfEvictions;
+	}
+}
@@ -6,11 +6,15 @@
 #include "AudioDevice.h"
 #include "RuntimeAudioImporterDefines.h"
 #include "RuntimeAudioImporterTypes.h"
+#include "RuntimeAudioDecodedCache.h"
+#include "RuntimeAudioScratchPool.h"
 #include "PreImportedSoundAsset.h"
 #include "RuntimeAudioTranscoder.h"
 #include "RuntimeAudioUtilities.h"
 
 #include "Codecs/RAW_RuntimeCodec.h"
+#include "Codecs/BaseRuntimeCodec.h"
+#include "Sound/StreamingSoundWave.h"
 
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
@@ -18,10 +22,73 @@
 #include "Codecs/RuntimeCodecFactory.h"
 #include "Engine/Engine.h"
 #include "UObject/WeakObjectPtrTemplates.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Templates/SharedPointer.h"
+#include "Containers/Ticker.h"
 
 #include "Interfaces/IAudioFormat.h"
 
+/** State of a batch import, shared between the importers of its items. Only accessed from the game thread */
+struct FRuntimeBatchImportState
+{
+	/** Paths to the files to import. Empty if importing from buffers */
+	TArray<FString> FilePaths;
+
+	/** Buffers to import. Empty if importing from files. Each buffer is moved out once its import starts */
+	TArray<TArray64<uint8>> AudioDataArrays;
+
+	/** Audio format of all items */
+	ERuntimeAudioFormat AudioFormat = ERuntimeAudioFormat::Auto;
+
+	/** Maximum number of items imported at once */
+	int32 MaxConcurrency = 1;
+
+	/** Index of the next item to start importing */
+	int32 NextItemIndex = 0;
+
+	/** Number of items whose import has completed */
+	int32 NumOfCompletedItems = 0;
+
+	/** Results of the items, in the batch order */
+	TArray<FRuntimeBatchImportItemResult> Results;
+
+	/**
+	 * References keeping the imported sound waves alive until the result of the whole batch is broadcast
+	 * The root set flag cannot be used for that, since the single imports clear it once their own result is broadcast. Should only be used in the game thread
+	 */
+	TArray<TStrongObjectPtr<UImportedSoundWave>> ImportedSoundWaves;
+
+	int32 GetNumOfItems() const
+	{
+		return Results.Num();
+	}
+};
+
+/** State of a streamed import, carried between the continuations of the decoding */
+struct FRuntimeStreamedImportState
+{
+	/** Stream decoder with the audio data to decode. Only used by one continuation at a time */
+	TSharedPtr<FBaseRuntimeStreamDecoder> StreamDecoder;
+
+	/** Streaming sound wave the decoded audio data is appended to. Not kept alive between the continuations, so the import stops once the user no longer references it */
+	TWeakObjectPtr<UStreamingSoundWave> StreamingSoundWave;
+
+	/** Duration of the audio decoded and appended at once, in seconds */
+	float ChunkDuration = 2.f;
+
+	/** Number of frames decoded so far */
+	int64 NumOfDecodedFrames = 0;
+
+	/** Whether the result has been broadcast, which happens once the first chunk is decoded */
+	bool bImportedFirstChunk = false;
+};
+
+namespace
+{
+	/** Number of chunks the decoding of a streamed import stays ahead of playback */
+	constexpr int32 NumOfStreamedChunksAhead = 3;
+}
+
 URuntimeAudioImporterLibrary* URuntimeAudioImporterLibrary::CreateRuntimeAudioImporter()
 {
 	return NewObject<URuntimeAudioImporterLibrary>();
@@ -54,14 +121,307 @@ void URuntimeAudioImporterLibrary::ImportAudioFromFile(const FString& FilePath,
 	AudioFormat = AudioFormat == ERuntimeAudioFormat::Auto ? URuntimeAudioUtilities::GetAudioFormat(FilePath) : AudioFormat;
 	AudioFormat = AudioFormat == ERuntimeAudioFormat::Invalid ? ERuntimeAudioFormat::Auto : AudioFormat;
 
-	TArray64<uint8> AudioBuffer;
-	if (!RuntimeAudioImporter::LoadAudioFileToArray(AudioBuffer, *FilePath))
+	// Looking up the decoded audio cache before loading the file, so a cached file is neither read nor decoded again
+	const FString CacheKey = FRuntimeAudioDecodedCache::Get().IsEnabled() ? FRuntimeAudioDecodedCache::MakeFileKey(FilePath, AudioFormat) : FString();
+	if (TryImportAudioFromCache(CacheKey))
+	{
+		return;
+	}
+
+	// Decoding directly from the memory-mapped file where possible, so the encoded data is not copied to the heap
+	FRuntimeBulkDataBuffer<uint8> AudioBuffer;
+	if (!RuntimeAudioImporter::LoadAudioFileToBulkData(AudioBuffer, FilePath))
 	{
 		OnResult_Internal(nullptr, ERuntimeImportStatus::LoadFileToArrayError);
 		return;
 	}
 
-	ImportAudioFromBuffer(MoveTemp(AudioBuffer), AudioFormat);
+	ImportAudioFromBuffer_Internal(MoveTemp(AudioBuffer), AudioFormat, CacheKey);
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromFileStreamed(const FString& FilePath, ERuntimeAudioFormat AudioFormat, float ChunkDuration)
+{
+	if (IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [WeakThis = MakeWeakObjectPtr(this), FilePath, AudioFormat, ChunkDuration]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->ImportAudioFromFileStreamed(FilePath, AudioFormat, ChunkDuration);
+			}
+			else
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to import streamed audio from file '%s' because the RuntimeAudioImporterLibrary object has been destroyed"), *FilePath);
+			}
+		});
+		return;
+	}
+
+	if (!FPaths::FileExists(FilePath))
+	{
+		OnResult_Internal(nullptr, ERuntimeImportStatus::AudioDoesNotExist);
+		return;
+	}
+
+	AudioFormat = AudioFormat == ERuntimeAudioFormat::Auto ? URuntimeAudioUtilities::GetAudioFormat(FilePath) : AudioFormat;
+
+	FRuntimeCodecFactory CodecFactory;
+	FBaseRuntimeCodec* RuntimeCodec = AudioFormat == ERuntimeAudioFormat::Invalid || AudioFormat == ERuntimeAudioFormat::Auto ? nullptr : CodecFactory.GetCodec(AudioFormat);
+
+	TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!FileHandle.IsValid())
+	{
+		OnResult_Internal(nullptr, ERuntimeImportStatus::LoadFileToArrayError);
+		return;
+	}
+
+	TSharedPtr<FBaseRuntimeStreamDecoder> StreamDecoder(RuntimeCodec ? RuntimeCodec->CreateStreamDecoder(MoveTemp(FileHandle)).Release() : nullptr);
+	if (!StreamDecoder.IsValid() || StreamDecoder->GetSampleRate() == 0 || StreamDecoder->GetNumOfChannels() == 0)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Unable to decode '%s' incrementally, importing the whole file instead"), *FilePath);
+		ImportAudioFromFile(FilePath, AudioFormat == ERuntimeAudioFormat::Invalid ? ERuntimeAudioFormat::Auto : AudioFormat);
+		return;
+	}
+
+	OnProgress_Internal(15);
+
+	// The sound wave has to be created in the game thread, while the decoding itself continues in the background
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this), StreamDecoder, ChunkDuration]()
+	{
+		if (!WeakThis.IsValid())
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to import streamed audio because the RuntimeAudioImporterLibrary object has been destroyed"));
+			return;
+		}
+
+		UStreamingSoundWave* StreamingSoundWave = UStreamingSoundWave::CreateStreamingSoundWave();
+		if (!StreamingSoundWave)
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while creating the streaming sound wave"));
+			WeakThis->OnResult_Internal(nullptr, ERuntimeImportStatus::SoundWaveDeclarationError);
+			return;
+		}
+
+		// Matching the format of the decoded audio data to avoid resampling and mixing every chunk
+		StreamingSoundWave->SetSampleRate(StreamDecoder->GetSampleRate());
+		StreamingSoundWave->NumChannels = StreamDecoder->GetNumOfChannels();
+
+		// Only the audio data between the playback position and the decoding position is kept in memory, plus one chunk behind the playback position for short rewinds
+		StreamingSoundWave->SetAutoReleasePlayedAudioData(true, ChunkDuration);
+
+		TSharedRef<FRuntimeStreamedImportState> StreamedImportState = MakeShared<FRuntimeStreamedImportState>();
+		StreamedImportState->StreamDecoder = StreamDecoder;
+		StreamedImportState->StreamingSoundWave = StreamingSoundWave;
+		StreamedImportState->ChunkDuration = ChunkDuration;
+
+		WeakThis->ContinueStreamedImport_Internal(StreamedImportState);
+	});
+}
+
+void URuntimeAudioImporterLibrary::ContinueStreamedImport_Internal(TSharedRef<FRuntimeStreamedImportState> StreamedImportState)
+{
+	if (!StreamedImportState->StreamingSoundWave.IsValid())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Stopped importing streamed audio because the streaming sound wave has been destroyed"));
+		return;
+	}
+
+	// Keeping both the importer and the sound wave alive while decoding, without touching their root set flag, which the user may have set as well
+	TStrongObjectPtr<URuntimeAudioImporterLibrary> StrongThis(this);
+	TStrongObjectPtr<UStreamingSoundWave> StrongStreamingSoundWave(StreamedImportState->StreamingSoundWave.Get());
+
+	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [StrongThis = MoveTemp(StrongThis), StrongStreamingSoundWave = MoveTemp(StrongStreamingSoundWave), StreamedImportState]() mutable
+	{
+		const bool bPaused = StrongThis->ImportAudioFromStreamDecoder(StreamedImportState, StrongStreamingSoundWave.Get());
+
+		// Strong object pointers have to be released in the game thread
+		AsyncTask(ENamedThreads::GameThread, [StrongThis = MoveTemp(StrongThis), StrongStreamingSoundWave = MoveTemp(StrongStreamingSoundWave), StreamedImportState, bPaused]() mutable
+		{
+			StrongStreamingSoundWave.Reset();
+
+			// Checking again in half a chunk, which is well before playback catches up with the decoded audio data
+			if (bPaused)
+			{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+				FTicker::GetCoreTicker()
+#else
+				FTSTicker::GetCoreTicker()
+#endif
+				.AddTicker(FTickerDelegate::CreateLambda([WeakThis = MakeWeakObjectPtr(StrongThis.Get()), StreamedImportState](float DeltaTime)
+				{
+					if (WeakThis.IsValid())
+					{
+						WeakThis->ContinueStreamedImport_Internal(StreamedImportState);
+					}
+					return false;
+				}), StreamedImportState->ChunkDuration / 2);
+			}
+
+			StrongThis.Reset();
+		});
+	});
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromFiles(const TArray<FString>& FilePaths, ERuntimeAudioFormat AudioFormat, int32 MaxConcurrency)
+{
+	TSharedRef<FRuntimeBatchImportState> BatchState = MakeShared<FRuntimeBatchImportState>();
+	BatchState->FilePaths = FilePaths;
+	BatchState->AudioFormat = AudioFormat;
+	BatchState->MaxConcurrency = MaxConcurrency;
+	BatchState->Results.SetNum(FilePaths.Num());
+	for (int32 ItemIndex = 0; ItemIndex < FilePaths.Num(); ++ItemIndex)
+	{
+		BatchState->Results[ItemIndex].Index = ItemIndex;
+		BatchState->Results[ItemIndex].FilePath = FilePaths[ItemIndex];
+	}
+
+	StartBatchImport_Internal(BatchState);
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromBuffers(TArray<TArray64<uint8>> AudioDataArrays, ERuntimeAudioFormat AudioFormat, int32 MaxConcurrency)
+{
+	TSharedRef<FRuntimeBatchImportState> BatchState = MakeShared<FRuntimeBatchImportState>();
+	BatchState->AudioFormat = AudioFormat;
+	BatchState->MaxConcurrency = MaxConcurrency;
+	BatchState->Results.SetNum(AudioDataArrays.Num());
+	for (int32 ItemIndex = 0; ItemIndex < AudioDataArrays.Num(); ++ItemIndex)
+	{
+		BatchState->Results[ItemIndex].Index = ItemIndex;
+	}
+	BatchState->AudioDataArrays = MoveTemp(AudioDataArrays);
+
+	StartBatchImport_Internal(BatchState);
+}
+
+void URuntimeAudioImporterLibrary::StartBatchImport_Internal(TSharedRef<FRuntimeBatchImportState> BatchState)
+{
+	// Making sure we are in the game thread, so the batch state is only accessed from one thread
+	if (!IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this), BatchState]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->StartBatchImport_Internal(BatchState);
+			}
+			else
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to start the batch import because the RuntimeAudioImporterLibrary object has been destroyed"));
+			}
+		});
+		return;
+	}
+
+	if (BatchState->MaxConcurrency <= 0)
+	{
+		BatchState->MaxConcurrency = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Starting the batch import of %d items with at most %d items imported at once"), BatchState->GetNumOfItems(), BatchState->MaxConcurrency);
+
+	if (BatchState->GetNumOfItems() == 0)
+	{
+		OnBatchItemResult_Internal(BatchState, INDEX_NONE, nullptr, ERuntimeImportStatus::FailedToReadAudioDataArray);
+		return;
+	}
+
+	const int32 NumOfInitialItems = FMath::Min(BatchState->MaxConcurrency, BatchState->GetNumOfItems());
+	for (int32 Index = 0; Index < NumOfInitialItems; ++Index)
+	{
+		ImportNextBatchItem_Internal(BatchState);
+	}
+}
+
+void URuntimeAudioImporterLibrary::ImportNextBatchItem_Internal(TSharedRef<FRuntimeBatchImportState> BatchState)
+{
+	if (BatchState->NextItemIndex >= BatchState->GetNumOfItems())
+	{
+		return;
+	}
+
+	const int32 ItemIndex = BatchState->NextItemIndex++;
+
+	// Each item is imported by its own importer, since an importer broadcasts the result of one import at a time
+	URuntimeAudioImporterLibrary* ItemImporter = CreateRuntimeAudioImporter();
+	ItemImporter->AddToRoot();
+	ItemImporter->OnResultNative.AddLambda([WeakThis = MakeWeakObjectPtr(this), BatchState, ItemIndex](URuntimeAudioImporterLibrary* Importer, UImportedSoundWave* ImportedSoundWave, ERuntimeImportStatus Status)
+	{
+		Importer->RemoveFromRoot();
+		if (WeakThis.IsValid())
+		{
+			WeakThis->OnBatchItemResult_Internal(BatchState, ItemIndex, ImportedSoundWave, Status);
+		}
+		else
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to record the result of the batch item %d because the RuntimeAudioImporterLibrary object has been destroyed"), ItemIndex);
+		}
+	});
+
+	if (BatchState->FilePaths.IsValidIndex(ItemIndex))
+	{
+		ItemImporter->ImportAudioFromFile(BatchState->FilePaths[ItemIndex], BatchState->AudioFormat);
+	}
+	else
+	{
+		ItemImporter->ImportAudioFromBuffer(MoveTemp(BatchState->AudioDataArrays[ItemIndex]), BatchState->AudioFormat);
+	}
+}
+
+void URuntimeAudioImporterLibrary::OnBatchItemResult_Internal(TSharedRef<FRuntimeBatchImportState> BatchState, int32 ItemIndex, UImportedSoundWave* ImportedSoundWave, ERuntimeImportStatus Status)
+{
+	if (BatchState->Results.IsValidIndex(ItemIndex))
+	{
+		// Keeping the imported sound wave alive until the result of the whole batch is broadcast
+		if (ImportedSoundWave)
+		{
+			BatchState->ImportedSoundWaves.Emplace(ImportedSoundWave);
+		}
+
+		FRuntimeBatchImportItemResult& ItemResult = BatchState->Results[ItemIndex];
+		ItemResult.ImportedSoundWave = ImportedSoundWave;
+		ItemResult.Status = Status;
+		++BatchState->NumOfCompletedItems;
+
+		if (OnBatchProgressNative.IsBound())
+		{
+			OnBatchProgressNative.Broadcast(this, BatchState->NumOfCompletedItems, BatchState->GetNumOfItems());
+		}
+
+		if (OnBatchProgress.IsBound())
+		{
+			OnBatchProgress.Broadcast(this, BatchState->NumOfCompletedItems, BatchState->GetNumOfItems());
+		}
+
+		ImportNextBatchItem_Internal(BatchState);
+	}
+
+	if (BatchState->NumOfCompletedItems < BatchState->GetNumOfItems())
+	{
+		return;
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The batch import of %d items has been completed"), BatchState->GetNumOfItems());
+
+	bool bBroadcasted{false};
+
+	if (OnBatchResultNative.IsBound())
+	{
+		bBroadcasted = true;
+		OnBatchResultNative.Broadcast(this, BatchState->Results);
+	}
+
+	if (OnBatchResult.IsBound())
+	{
+		bBroadcasted = true;
+		OnBatchResult.Broadcast(this, BatchState->Results);
+	}
+
+	if (!bBroadcasted)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("You did not bind to the delegate to get the result of the batch import"));
+	}
+
+	BatchState->ImportedSoundWaves.Empty();
 }
 
 void URuntimeAudioImporterLibrary::ImportAudioFromPreImportedSound(UPreImportedSoundAsset* PreImportedSoundAsset)
@@ -92,6 +452,25 @@ void URuntimeAudioImporterLibrary::ImportAudioFromBuffer(TArray64<uint8> AudioDa
 		return;
 	}
 
+	const FString CacheKey = FRuntimeAudioDecodedCache::Get().IsEnabled() && AudioFormat != ERuntimeAudioFormat::Invalid ? FRuntimeAudioDecodedCache::MakeContentKey(AudioData.GetData(), AudioData.Num(), AudioFormat) : FString();
+	if (TryImportAudioFromCache(CacheKey))
+	{
+		return;
+	}
+
+	// Handing the array's allocation over to the bulk data buffer instead of copying the encoded audio data
+	uint8* AudioDataPtr = AudioData.GetData();
+	const int64 AudioDataSize = AudioData.Num();
+	FRuntimeBulkDataBuffer<uint8> AudioBuffer(AudioDataPtr, AudioDataSize, [AudioData = MoveTemp(AudioData)]() mutable
+	{
+		AudioData.Empty();
+	});
+
+	ImportAudioFromBuffer_Internal(MoveTemp(AudioBuffer), AudioFormat, CacheKey);
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromBuffer_Internal(FRuntimeBulkDataBuffer<uint8>&& AudioData, ERuntimeAudioFormat AudioFormat, const FString& CacheKey)
+{
 	OnProgress_Internal(15);
 
 	if (AudioFormat == ERuntimeAudioFormat::Invalid)
@@ -101,7 +480,7 @@ void URuntimeAudioImporterLibrary::ImportAudioFromBuffer(TArray64<uint8> AudioDa
 		return;
 	}
 
-	FEncodedAudioStruct EncodedAudioInfo(AudioData, AudioFormat);
+	FEncodedAudioStruct EncodedAudioInfo(MoveTemp(AudioData), AudioFormat);
 
 	OnProgress_Internal(25);
 
@@ -114,7 +493,68 @@ void URuntimeAudioImporterLibrary::ImportAudioFromBuffer(TArray64<uint8> AudioDa
 
 	OnProgress_Internal(65);
 
-	ImportAudioFromDecodedInfo(MoveTemp(DecodedAudioInfo));
+	if (CacheKey.IsEmpty())
+	{
+		ImportAudioFromDecodedInfo(MoveTemp(DecodedAudioInfo));
+		return;
+	}
+
+	// Sharing the decoded PCM data between the cache and the imported sound wave, so caching it does not require a copy
+	FRuntimeAudioDecodedCache::FEntry CacheEntry;
+	CacheEntry.PCMInfo = MakeShared<FPCMStruct>(MoveTemp(DecodedAudioInfo.PCMInfo));
+	CacheEntry.SoundWaveBasicInfo = DecodedAudioInfo.SoundWaveBasicInfo;
+	FRuntimeAudioDecodedCache::Get().Add(CacheKey, CacheEntry);
+
+	ImportAudioFromSharedPCM(CacheEntry.SoundWaveBasicInfo, MoveTemp(CacheEntry.PCMInfo));
+}
+
+bool URuntimeAudioImporterLibrary::TryImportAudioFromCache(const FString& CacheKey)
+{
+	if (CacheKey.IsEmpty())
+	{
+		return false;
+	}
+
+	FRuntimeAudioDecodedCache::FEntry CacheEntry;
+	if (!FRuntimeAudioDecodedCache::Get().Find(CacheKey, CacheEntry))
+	{
+		return false;
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Importing audio from the decoded audio cache using the key '%s'"), *CacheKey);
+	OnProgress_Internal(65);
+	ImportAudioFromSharedPCM(CacheEntry.SoundWaveBasicInfo, MoveTemp(CacheEntry.PCMInfo));
+	return true;
+}
+
+void URuntimeAudioImporterLibrary::SetDecodedAudioCacheBudget(int64 BudgetBytes)
+{
+	FRuntimeAudioDecodedCache::Get().SetBudget(BudgetBytes);
+}
+
+FRuntimeAudioCacheStats URuntimeAudioImporterLibrary::GetDecodedAudioCacheStats()
+{
+	return FRuntimeAudioDecodedCache::Get().GetStats();
+}
+
+void URuntimeAudioImporterLibrary::ClearDecodedAudioCache()
+{
+	FRuntimeAudioDecodedCache::Get().Empty();
+}
+
+void URuntimeAudioImporterLibrary::SetScratchBufferPoolBudget(int64 BudgetBytes)
+{
+	FRuntimeAudioScratchPool::Get().SetBudget(BudgetBytes);
+}
+
+FRuntimeAudioScratchPoolStats URuntimeAudioImporterLibrary::GetScratchBufferPoolStats()
+{
+	return FRuntimeAudioScratchPool::Get().GetStats();
+}
+
+void URuntimeAudioImporterLibrary::ClearScratchBufferPool()
+{
+	FRuntimeAudioScratchPool::Get().Empty();
 }
 
 void URuntimeAudioImporterLibrary::ImportAudioFromRAWFile(const FString& FilePath, ERuntimeRAWAudioFormat RAWFormat, int32 SampleRate, int32 NumOfChannels)
@@ -459,6 +899,122 @@ void URuntimeAudioImporterLibrary::ImportAudioFromDecodedInfo(FDecodedAudioStruc
 	ImportedSoundWave->RemoveFromRoot();
 }
 
+void URuntimeAudioImporterLibrary::ImportAudioFromSharedPCM(const FSoundWaveBasicStruct& SoundWaveBasicInfo, TSharedPtr<FPCMStruct> SharedPCMInfo)
+{
+	// Making sure we are in the game thread
+	if (!IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this), SoundWaveBasicInfo, SharedPCMInfo = MoveTemp(SharedPCMInfo)]() mutable
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->ImportAudioFromSharedPCM(SoundWaveBasicInfo, MoveTemp(SharedPCMInfo));
+			}
+			else
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to import audio from shared PCM data '%s' because the RuntimeAudioImporterLibrary object has been destroyed"), *SoundWaveBasicInfo.ToString());
+			}
+		});
+		return;
+	}
+
+	UImportedSoundWave* ImportedSoundWave = UImportedSoundWave::CreateImportedSoundWave();
+	if (!ImportedSoundWave)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while creating the imported sound wave"));
+		OnResult_Internal(nullptr, ERuntimeImportStatus::SoundWaveDeclarationError);
+		return;
+	}
+
+	ImportedSoundWave->AddToRoot();
+
+	OnProgress_Internal(75);
+
+	ImportedSoundWave->PopulateAudioDataFromSharedPCM(SoundWaveBasicInfo, MoveTemp(SharedPCMInfo));
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The audio data was successfully imported"));
+
+	OnProgress_Internal(100);
+
+	OnResult_Internal(ImportedSoundWave, ERuntimeImportStatus::SuccessfulImport);
+
+	ImportedSoundWave->RemoveFromRoot();
+}
+
+bool URuntimeAudioImporterLibrary::ImportAudioFromStreamDecoder(TSharedRef<FRuntimeStreamedImportState> StreamedImportState, UStreamingSoundWave* StreamingSoundWave)
+{
+	FBaseRuntimeStreamDecoder* StreamDecoder = StreamedImportState->StreamDecoder.Get();
+	const uint32 SampleRate = StreamDecoder->GetSampleRate();
+	const uint32 NumOfChannels = StreamDecoder->GetNumOfChannels();
+	const int64 NumOfChunkFrames = FMath::Max<int64>(static_cast<int64>(SampleRate * StreamedImportState->ChunkDuration), 1024);
+
+	// Every chunk is copied into the sound wave when appended, so a single scratch buffer is reused for all of them
+	TRuntimeAudioScratchBuffer<float> ChunkPCMData(NumOfChunkFrames * NumOfChannels);
+	if (!ChunkPCMData.IsValid())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate memory for a streamed audio chunk of %lld frames"), NumOfChunkFrames);
+		if (!StreamedImportState->bImportedFirstChunk)
+		{
+			OnResult_Internal(nullptr, ERuntimeImportStatus::FailedToReadAudioDataArray);
+		}
+		return false;
+	}
+
+	while (true)
+	{
+		// Pausing once the decoded audio data is far enough ahead of playback. The playback time includes the released audio data, so it is comparable to the number of decoded frames
+		// A looping sound wave returns to the start of its audio data, which cannot be released, so it is decoded as a whole
+		if (StreamedImportState->bImportedFirstChunk && !StreamingSoundWave->IsLooping())
+		{
+			const int64 NumOfPlayedFrames = static_cast<int64>(static_cast<double>(StreamingSoundWave->GetPlaybackTime()) * SampleRate);
+			if (StreamedImportState->NumOfDecodedFrames - NumOfPlayedFrames >= NumOfChunkFrames * NumOfStreamedChunksAhead)
+			{
+				return true;
+			}
+		}
+
+		const int64 NumOfDecodedFrames = StreamDecoder->DecodeFrames(NumOfChunkFrames, ChunkPCMData.GetData());
+		if (NumOfDecodedFrames <= 0)
+		{
+			break;
+		}
+
+		// Appending directly rather than through the sound wave's queue, which is reserved for the audio data appended by the user
+		if (!StreamingSoundWave->AppendPCMData(ChunkPCMData.GetData(), NumOfDecodedFrames * NumOfChannels, SampleRate, NumOfChannels))
+		{
+			break;
+		}
+
+		StreamedImportState->NumOfDecodedFrames += NumOfDecodedFrames;
+
+		// Playback can start as soon as the first chunk is in place
+		if (!StreamedImportState->bImportedFirstChunk)
+		{
+			StreamedImportState->bImportedFirstChunk = true;
+			OnResult_Internal(StreamingSoundWave, ERuntimeImportStatus::SuccessfulImport);
+		}
+
+		if (StreamDecoder->GetFileSize() > 0)
+		{
+			OnProgress_Internal(15 + static_cast<int32>(85 * StreamDecoder->GetFilePosition() / StreamDecoder->GetFileSize()));
+		}
+	}
+
+	if (!StreamedImportState->bImportedFirstChunk)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to decode any streamed audio data"));
+		OnResult_Internal(nullptr, ERuntimeImportStatus::FailedToReadAudioDataArray);
+		return false;
+	}
+
+	// Appending the frames held back by the resampler, in case the sound wave's format has been changed in the meantime
+	StreamingSoundWave->AppendPCMData(nullptr, 0, SampleRate, NumOfChannels, true);
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The streamed audio data was successfully imported"));
+	OnProgress_Internal(100);
+	return false;
+}
+
 void URuntimeAudioImporterLibrary::ImportAudioFromFloat32Buffer(FRuntimeBulkDataBuffer<float>&& PCMData, int32 SampleRate, int32 NumOfChannels)
 {
 	FDecodedAudioStruct DecodedAudioInfo;
@@ -479,7 +1035,7 @@ void URuntimeAudioImporterLibrary::ImportAudioFromFloat32Buffer(FRuntimeBulkData
 bool URuntimeAudioImporterLibrary::DecodeAudioData(FEncodedAudioStruct&& EncodedAudioInfo, FDecodedAudioStruct& DecodedAudioInfo)
 {
 	FRuntimeCodecFactory CodecFactory;
-	TUniquePtr<FBaseRuntimeCodec> RuntimeCodec = [&EncodedAudioInfo, &CodecFactory]()
+	FBaseRuntimeCodec* RuntimeCodec = [&EncodedAudioInfo, &CodecFactory]()
 	{
 		if (EncodedAudioInfo.AudioFormat == ERuntimeAudioFormat::Auto)
 		{
@@ -513,8 +1069,8 @@ bool URuntimeAudioImporterLibrary::EncodeAudioData(FDecodedAudioStruct&& Decoded
 	}
 
 	FRuntimeCodecFactory CodecFactory;
-	TUniquePtr<FBaseRuntimeCodec> RuntimeCodec = CodecFactory.GetCodec(EncodedAudioInfo.AudioFormat);
-	if (!RuntimeCodec.IsValid())
+	FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(EncodedAudioInfo.AudioFormat);
+	if (!RuntimeCodec)
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Undefined audio data format for encoding"));
 		return false;
@@ -0,0 +1,163 @@
+﻿// Georgy Treshchev 2024.
+
+#include "RuntimeAudioScratchPool.h"
+
+#include "RuntimeAudioImporterDefines.h"
+
+FRuntimeAudioScratchPool::~FRuntimeAudioScratchPool()
+{
+	Empty();
+}
+
+FRuntimeAudioScratchPool& FRuntimeAudioScratchPool::Get()
+{
+	static FRuntimeAudioScratchPool Instance;
+	return Instance;
+}
+
+void* FRuntimeAudioScratchPool::Acquire(int64 NumOfBytes, int64& OutCapacity)
+{
+	OutCapacity = 0;
+	if (NumOfBytes <= 0)
+	{
+		return nullptr;
+	}
+
+	const int64 PooledCapacity = static_cast<int64>(FMath::RoundUpToPowerOfTwo64(static_cast<uint64>(FMath::Max<int64>(NumOfBytes, MinSizeClassBytes))));
+	const int32 SizeClassIndex = GetSizeClassIndex(PooledCapacity);
+
+	bool bBypassPool;
+	{
+		FRAIScopeLock Lock(&DataGuard);
+		bBypassPool = SizeClassIndex == INDEX_NONE || PooledCapacity > BudgetBytes;
+		if (!bBypassPool && FreeBuffers[SizeClassIndex].Num() > 0)
+		{
+			++NumOfHits;
+			RetainedBytes -= PooledCapacity;
+			OutCapacity = PooledCapacity;
+			return FreeBuffers[SizeClassIndex].Pop();
+		}
+		++NumOfMisses;
+	}
+
+	// Buffers that could never be retained are allocated with the exact size to avoid wasting memory on rounding up
+	const int64 Capacity = bBypassPool ? NumOfBytes : PooledCapacity;
+	void* Buffer = FMemory::Malloc(Capacity, Alignment);
+	if (!Buffer)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to allocate a scratch buffer of %lld bytes"), Capacity);
+		return nullptr;
+	}
+
+	OutCapacity = Capacity;
+	return Buffer;
+}
+
+void FRuntimeAudioScratchPool::Release(void* Buffer, int64 Capacity)
+{
+	if (!Buffer)
+	{
+		return;
+	}
+
+	const int32 SizeClassIndex = FMath::IsPowerOfTwo(Capacity) ? GetSizeClassIndex(Capacity) : INDEX_NONE;
+	{
+		FRAIScopeLock Lock(&DataGuard);
+		if (SizeClassIndex != INDEX_NONE && RetainedBytes + Capacity <= BudgetBytes)
+		{
+			FreeBuffers[SizeClassIndex].Add(Buffer);
+			RetainedBytes += Capacity;
+			PeakRetainedBytes = FMath::Max<int64>(PeakRetainedBytes, RetainedBytes);
+			return;
+		}
+		++NumOfDiscards;
+	}
+
+	FMemory::Free(Buffer);
+}
+
+void FRuntimeAudioScratchPool::SetBudget(int64 InBudgetBytes)
+{
+	TArray<void*> BuffersToFree;
+	{
+		FRAIScopeLock Lock(&DataGuard);
+		BudgetBytes = FMath::Max<int64>(InBudgetBytes, 0);
+		TrimToBudget_Internal(BuffersToFree);
+		UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Scratch buffer pool budget set to %lld bytes"), BudgetBytes);
+	}
+
+	for (void* Buffer : BuffersToFree)
+	{
+		FMemory::Free(Buffer);
+	}
+}
+
+void FRuntimeAudioScratchPool::Empty()
+{
+	TArray<void*> BuffersToFree;
+	{
+		FRAIScopeLock Lock(&DataGuard);
+		for (TArray<void*>& SizeClassBuffers : FreeBuffers)
+		{
+			BuffersToFree.Append(SizeClassBuffers);
+			SizeClassBuffers.Empty();
+		}
+		RetainedBytes = 0;
+	}
+
+	for (void* Buffer : BuffersToFree)
+	{
+		FMemory::Free(Buffer);
+	}
+}
+
+FRuntimeAudioScratchPoolStats FRuntimeAudioScratchPool::GetStats() const
+{
+	FRAIScopeLock Lock(&DataGuard);
+	FRuntimeAudioScratchPoolStats Stats;
+	Stats.NumOfHits = NumOfHits;
+	Stats.NumOfMisses = NumOfMisses;
+	Stats.NumOfDiscards = NumOfDiscards;
+	for (const TArray<void*>& SizeClassBuffers : FreeBuffers)
+	{
+		Stats.NumOfRetainedBuffers += SizeClassBuffers.Num();
+	}
+	Stats.RetainedBytes = RetainedBytes;
+	Stats.PeakRetainedBytes = PeakRetainedBytes;
+	Stats.BudgetBytes = BudgetBytes;
+	return Stats;
+}
+
+void FRuntimeAudioScratchPool::ResetStats()
+{
+	FRAIScopeLock Lock(&DataGuard);
+	NumOfHits = 0;
+	NumOfMisses = 0;
+	NumOfDiscards = 0;
+	PeakRetainedBytes = RetainedBytes;
+}
+
+int32 FRuntimeAudioScratchPool::GetSizeClassIndex(int64 Capacity)
+{
+	if (Capacity < MinSizeClassBytes)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 SizeClassIndex = static_cast<int32>(FMath::FloorLog2_64(static_cast<uint64>(Capacity)) - FMath::FloorLog2_64(static_cast<uint64>(MinSizeClassBytes)));
+	return SizeClassIndex < NumOfSizeClasses ? SizeClassIndex : INDEX_NONE;
+}
+
+void FRuntimeAudioScratchPool::TrimToBudget_Internal(TArray<void*>& OutBuffersToFree)
+{
+	for (int32 SizeClassIndex = NumOfSizeClasses - 1; SizeClassIndex >= 0 && RetainedBytes > BudgetBytes; --SizeClassIndex)
+	{
+		const int64 SizeClassBytes = MinSizeClassBytes << SizeClassIndex;
+		TArray<void*>& SizeClassBuffers = FreeBuffers[SizeClassIndex];
+		while (SizeClassBuffers.Num() > 0 && RetainedBytes > BudgetBytes)
+		{
+			OutBuffersToFree.Add(SizeClassBuffers.Pop());
+			RetainedBytes -= SizeClassBytes;
+		}
+	}
+}
@@ -200,6 +200,19 @@ void URuntimeAudioTranscoder::TranscodeEncodedDataFromBuffer(TArray64<uint8> Enc
 		return;
 	}
 
+	// Handing the array's allocation over to the encoded audio info instead of copying the encoded audio data
+	uint8* EncodedDataPtr = EncodedDataFrom.GetData();
+	const int64 EncodedDataSize = EncodedDataFrom.Num();
+	FRuntimeBulkDataBuffer<uint8> EncodedBufferFrom(EncodedDataPtr, EncodedDataSize, [EncodedDataFrom = MoveTemp(EncodedDataFrom)]() mutable
+	{
+		EncodedDataFrom.Empty();
+	});
+
+	TranscodeEncodedData_Internal(FEncodedAudioStruct(MoveTemp(EncodedBufferFrom), EncodedFormatFrom), EncodedFormatTo, Quality, OverrideOptions, Result);
+}
+
+void URuntimeAudioTranscoder::TranscodeEncodedData_Internal(FEncodedAudioStruct&& EncodedAudioInfoFrom, ERuntimeAudioFormat EncodedFormatTo, uint8 Quality, const FRuntimeAudioExportOverrideOptions& OverrideOptions, const FOnEncodedDataTranscodeFromBufferResultNative& Result)
+{
 	auto ExecuteResult = [Result](bool bSucceeded, TArray64<uint8>&& AudioData)
 	{
 		AsyncTask(ENamedThreads::GameThread, [Result, bSucceeded, AudioData]()
@@ -210,7 +223,7 @@ void URuntimeAudioTranscoder::TranscodeEncodedDataFromBuffer(TArray64<uint8> Enc
 
 	FDecodedAudioStruct DecodedAudioInfo;
 	{
-		FEncodedAudioStruct EncodedAudioInfo(MoveTemp(EncodedDataFrom), EncodedFormatFrom);
+		FEncodedAudioStruct EncodedAudioInfo(MoveTemp(EncodedAudioInfoFrom));
 		if (!URuntimeAudioImporterLibrary::DecodeAudioData(MoveTemp(EncodedAudioInfo), DecodedAudioInfo))
 		{
 			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to decode audio data"));
@@ -298,15 +311,16 @@ void URuntimeAudioTranscoder::TranscodeEncodedDataFromFile(const FString& FilePa
 		});
 	};
 
-	TArray64<uint8> AudioBuffer;
-	if (!RuntimeAudioImporter::LoadAudioFileToArray(AudioBuffer, *FilePathFrom))
+	// Decoding directly from the memory-mapped file where possible, so the encoded data is not copied to the heap
+	FRuntimeBulkDataBuffer<uint8> AudioBuffer;
+	if (!RuntimeAudioImporter::LoadAudioFileToBulkData(AudioBuffer, FilePathFrom))
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong when reading audio data on the path '%s' for transcoding"), *FilePathFrom);
 		ExecuteResult(false);
 		return;
 	}
 
-	TranscodeEncodedDataFromBuffer(MoveTemp(AudioBuffer), EncodedFormatFrom, EncodedFormatTo, Quality, OverrideOptions, FOnEncodedDataTranscodeFromBufferResultNative::CreateLambda([ExecuteResult, FilePathTo](bool bSucceeded, const TArray64<uint8>& EncodedData)
+	TranscodeEncodedData_Internal(FEncodedAudioStruct(MoveTemp(AudioBuffer), EncodedFormatFrom), EncodedFormatTo, Quality, OverrideOptions, FOnEncodedDataTranscodeFromBufferResultNative::CreateLambda([ExecuteResult, FilePathTo](bool bSucceeded, const TArray64<uint8>& EncodedData)
 	{
 		if (!bSucceeded)
 		{
@@ -5,13 +5,14 @@
 
 #include "Codecs/BaseRuntimeCodec.h"
 #include "Codecs/RuntimeCodecFactory.h"
+#include "Async/ParallelFor.h"
 
 ERuntimeAudioFormat URuntimeAudioUtilities::GetAudioFormat(const FString& FilePath)
 {
 	FRuntimeCodecFactory CodecFactory;
-	TUniquePtr<FBaseRuntimeCodec> RuntimeCodec = CodecFactory.GetCodec(FilePath);
+	FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(FilePath);
 
-	if (!RuntimeCodec.IsValid())
+	if (!RuntimeCodec)
 	{
 		return ERuntimeAudioFormat::Invalid;
 	}
@@ -44,18 +45,51 @@ void URuntimeAudioUtilities::GetAudioHeaderInfoFromFile(const FString& FilePath,
 			});
 		};
 
-		TArray64<uint8> AudioBuffer;
-		if (!RuntimeAudioImporter::LoadAudioFileToArray(AudioBuffer, *FilePath))
+		FRuntimeAudioHeaderInfo HeaderInfo;
+		const bool bSucceeded = GetAudioHeaderInfoFromFile_Internal(FilePath, HeaderInfo);
+		ExecuteResult(bSucceeded, bSucceeded ? MoveTemp(HeaderInfo) : FRuntimeAudioHeaderInfo());
+	});
+}
+
+bool URuntimeAudioUtilities::GetAudioHeaderInfoFromFile_Internal(const FString& FilePath, FRuntimeAudioHeaderInfo& HeaderInfo)
+{
+	FRuntimeCodecFactory CodecFactory;
+
+	// Reading only the header first, which is enough for most files and avoids loading the whole file
+	if (FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(FilePath))
+	{
+		TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+		if (!FileHandle.IsValid())
 		{
-			ExecuteResult(false, FRuntimeAudioHeaderInfo());
-			return;
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to open the audio file '%s' to retrieve its header information"), *FilePath);
+			return false;
 		}
 
-		GetAudioHeaderInfoFromBuffer(MoveTemp(AudioBuffer), FOnGetAudioHeaderInfoResultNative::CreateLambda([Result](bool bSucceeded, const FRuntimeAudioHeaderInfo& HeaderInfo)
+		if (RuntimeCodec->GetHeaderInfoFromFile(MoveTemp(FileHandle), HeaderInfo))
 		{
-			Result.ExecuteIfBound(bSucceeded, HeaderInfo);
-		}));
-	});
+			return true;
+		}
+	}
+
+	FRuntimeBulkDataBuffer<uint8> BulkAudioData;
+	if (!RuntimeAudioImporter::LoadAudioFileToBulkData(BulkAudioData, FilePath))
+	{
+		return false;
+	}
+
+	FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(BulkAudioData);
+	if (!RuntimeCodec)
+	{
+		return false;
+	}
+
+	FEncodedAudioStruct EncodedData;
+	{
+		EncodedData.AudioData = MoveTemp(BulkAudioData);
+		EncodedData.AudioFormat = RuntimeCodec->GetAudioFormat();
+	}
+
+	return RuntimeCodec->GetHeaderInfo(MoveTemp(EncodedData), HeaderInfo);
 }
 
 void URuntimeAudioUtilities::GetAudioHeaderInfoFromBuffer(TArray<uint8> AudioData, const FOnGetAudioHeaderInfoResult& Result)
@@ -81,9 +115,9 @@ void URuntimeAudioUtilities::GetAudioHeaderInfoFromBuffer(TArray64<uint8> AudioD
 		FRuntimeBulkDataBuffer<uint8> BulkAudioData = FRuntimeBulkDataBuffer<uint8>(AudioData);
 
 		FRuntimeCodecFactory CodecFactory;
-		TUniquePtr<FBaseRuntimeCodec> RuntimeCodec = CodecFactory.GetCodec(BulkAudioData);
+		FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(BulkAudioData);
 
-		if (!RuntimeCodec.IsValid())
+		if (!RuntimeCodec)
 		{
 			ExecuteResult(false, FRuntimeAudioHeaderInfo());
 			return;
@@ -114,9 +148,9 @@ ERuntimeAudioFormat URuntimeAudioUtilities::GetAudioFormatAdvanced(const TArray6
 ERuntimeAudioFormat URuntimeAudioUtilities::GetAudioFormatAdvanced(const FRuntimeBulkDataBuffer<uint8>& AudioData)
 {
 	FRuntimeCodecFactory CodecFactory;
-	TUniquePtr<FBaseRuntimeCodec> RuntimeCodec = CodecFactory.GetCodec(AudioData);
+	FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(AudioData);
 
-	if (!RuntimeCodec.IsValid())
+	if (!RuntimeCodec)
 	{
 		return ERuntimeAudioFormat::Invalid;
 	}
@@ -179,7 +213,7 @@ void URuntimeAudioUtilities::ScanDirectoryForAudioFiles(const FString& Directory
 				}
 
 				FString AudioFilePath = FilenameOrDirectory;
-				if (CodecFactory.GetCodec(AudioFilePath).IsValid())
+				if (CodecFactory.GetCodec(AudioFilePath) != nullptr)
 				{
 					AudioFilePaths.Add(MoveTemp(AudioFilePath));
 				}
@@ -201,3 +235,63 @@ void URuntimeAudioUtilities::ScanDirectoryForAudioFiles(const FString& Directory
 		ExecuteResult(bSucceeded, MoveTemp(DirectoryVisitor_AudioScanner.AudioFilePaths));
 	});
 }
+
+void URuntimeAudioUtilities::ScanDirectoryForAudioHeaderInfo(const FString& Directory, bool bRecursive, const FOnScanDirectoryForAudioHeaderInfoProgress& Progress, const FOnScanDirectoryForAudioHeaderInfoResult& Result)
+{
+	ScanDirectoryForAudioHeaderInfo(Directory, bRecursive, FOnScanDirectoryForAudioHeaderInfoProgressNative::CreateLambda([Progress](const TArray<FRuntimeAudioFileHeaderInfo>& FileHeaderInfos)
+	{
+		Progress.ExecuteIfBound(FileHeaderInfos);
+	}), FOnScanDirectoryForAudioHeaderInfoResultNative::CreateLambda([Result](bool bSucceeded, const TArray<FRuntimeAudioFileHeaderInfo>& FileHeaderInfos)
+	{
+		Result.ExecuteIfBound(bSucceeded, FileHeaderInfos);
+	}));
+}
+
+void URuntimeAudioUtilities::ScanDirectoryForAudioHeaderInfo(const FString& Directory, bool bRecursive, const FOnScanDirectoryForAudioHeaderInfoProgressNative& Progress, const FOnScanDirectoryForAudioHeaderInfoResultNative& Result)
+{
+	ScanDirectoryForAudioFiles(Directory, bRecursive, FOnScanDirectoryForAudioFilesResultNative::CreateLambda([Progress, Result](bool bSucceeded, const TArray<FString>& AudioFilePaths)
+	{
+		if (!bSucceeded)
+		{
+			Result.ExecuteIfBound(false, TArray<FRuntimeAudioFileHeaderInfo>());
+			return;
+		}
+
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [AudioFilePaths, Progress, Result]
+		{
+			// Files are processed in groups, each broadcast as soon as it is complete, so the results arrive incrementally without a game thread task per file
+			constexpr int32 NumOfFilesPerGroup = 32;
+			const int32 NumOfGroups = FMath::DivideAndRoundUp(AudioFilePaths.Num(), NumOfFilesPerGroup);
+
+			TArray<FRuntimeAudioFileHeaderInfo> FileHeaderInfos;
+			FileHeaderInfos.SetNum(AudioFilePaths.Num());
+
+			ParallelFor(NumOfGroups, [&AudioFilePaths, &FileHeaderInfos, &Progress, NumOfFilesPerGroup](int32 GroupIndex)
+			{
+				const int32 FirstFileIndex = GroupIndex * NumOfFilesPerGroup;
+				const int32 NumOfFilesInGroup = FMath::Min(NumOfFilesPerGroup, AudioFilePaths.Num() - FirstFileIndex);
+
+				for (int32 FileIndex = FirstFileIndex; FileIndex < FirstFileIndex + NumOfFilesInGroup; ++FileIndex)
+				{
+					FRuntimeAudioFileHeaderInfo& FileHeaderInfo = FileHeaderInfos[FileIndex];
+					FileHeaderInfo.FilePath = AudioFilePaths[FileIndex];
+					FileHeaderInfo.bSucceeded = GetAudioHeaderInfoFromFile_Internal(FileHeaderInfo.FilePath, FileHeaderInfo.HeaderInfo);
+				}
+
+				if (Progress.IsBound())
+				{
+					TArray<FRuntimeAudioFileHeaderInfo> GroupFileHeaderInfos(FileHeaderInfos.GetData() + FirstFileIndex, NumOfFilesInGroup);
+					AsyncTask(ENamedThreads::GameThread, [Progress, GroupFileHeaderInfos = MoveTemp(GroupFileHeaderInfos)]()
+					{
+						Progress.ExecuteIfBound(GroupFileHeaderInfos);
+					});
+				}
+			});
+
+			AsyncTask(ENamedThreads::GameThread, [Result, FileHeaderInfos = MoveTemp(FileHeaderInfos)]()
+			{
+				Result.ExecuteIfBound(true, FileHeaderInfos);
+			});
+		});
+	}));
+}
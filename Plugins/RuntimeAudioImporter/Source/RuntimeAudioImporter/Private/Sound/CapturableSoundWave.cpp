@@ -7,6 +7,15 @@
 #include "Async/Async.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
+namespace
+{
+	/** Number of channels the capture ring buffer is initially sized for if the capture device does not report its number of channels */
+	constexpr int32 DefaultNumOfCaptureChannels = 2;
+
+	/** Number of capture callbacks the capture ring buffer can hold while the sound wave is busy */
+	constexpr int32 NumOfBufferedCaptureCallbacks = 4;
+}
+
 UCapturableSoundWave::UCapturableSoundWave(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -106,22 +115,13 @@ bool UCapturableSoundWave::StartCapture(int32 DeviceId)
 
 		if (WeakThis->AudioCapture.IsCapturing())
 		{
-			const int64 PCMDataSize = NumOfChannels * NumFrames;
-			int64 PCMDataSizeInBytes = PCMDataSize * sizeof(float);
-
-			if (PCMDataSizeInBytes > TNumericLimits<int32>::Max())
-			{
-				UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to append audio data as the size of the data exceeds the maximum size of int32 (PCMDataSizeInBytes: %lld, Max: %d)"), PCMDataSizeInBytes, TNumericLimits<int32>::Max());
-				PCMDataSizeInBytes = TNumericLimits<int32>::Max();
-			}
-
-			WeakThis->AppendAudioDataFromRAW(TArray<uint8>(reinterpret_cast<const uint8*>(PCMData), static_cast<int32>(PCMDataSizeInBytes)), ERuntimeRAWAudioFormat::Float32,
+			WeakThis->ProcessCapturedAudioData(static_cast<const float*>(PCMData), NumFrames, NumOfChannels,
 #if UE_VERSION_NEWER_THAN(4, 25, 0)
 				InSampleRate
 #else
 				WeakThis->AudioCapture.GetSampleRate()
 #endif
-			  , NumOfChannels);
+			  , bOverFlow);
 		}
 	};
 
@@ -137,12 +137,20 @@ bool UCapturableSoundWave::StartCapture(int32 DeviceId)
 #else
 		OpenCaptureStream
 #endif
-		(Params, MoveTemp(OnCapture), 1024))
+		(Params, MoveTemp(OnCapture), CaptureFrameSize))
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to open capturing stream for sound wave %s"), *GetName());
 		return false;
 	}
 
+	// Sizing the ring buffer for the number of channels of the opened stream. The stream is not started yet, so the capture thread is not using the ring buffer
+	// If the device delivers larger buffers than requested, the ring buffer is grown in the capture thread
+	{
+		Audio::FCaptureDeviceInfo DeviceInfo;
+		const int32 NumOfStreamChannels = AudioCapture.GetCaptureDeviceInfo(DeviceInfo, DeviceId) && DeviceInfo.InputChannels > 0 ? DeviceInfo.InputChannels : DefaultNumOfCaptureChannels;
+		CaptureRingBuffer.Initialize(CaptureFrameSize * NumOfStreamChannels * NumOfBufferedCaptureCallbacks);
+	}
+
 	if (!AudioCapture.StartStream())
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to start capturing for sound wave %s"), *GetName());
@@ -164,6 +172,20 @@ void UCapturableSoundWave::StopCapture()
 	{
 		AudioCapture.CloseStream();
 	}
+
+	// Appending the audio data left behind by the capture callbacks that found the sound wave busy. The stream is closed, so the capture thread is no longer using the ring buffer
+	const bool bCopyAppendedPCMData = IsPopulateAudioDataBound();
+	TArray<float> AppendedPCMData;
+	bool bAppended;
+	{
+		FRAIScopeLock Lock(&*DataGuard);
+		bAppended = AppendCaptureRingBuffer_Internal(bCopyAppendedPCMData ? &AppendedPCMData : nullptr);
+	}
+
+	if (bAppended)
+	{
+		BroadcastPopulatedAudioData(MoveTemp(AppendedPCMData));
+	}
 #else
 	UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to stop capturing as its support is disabled (please enable in RuntimeAudioImporter.Build.cs)"));
 #endif
@@ -234,3 +256,135 @@ bool UCapturableSoundWave::IsCapturing() const
 	return false;
 #endif
 }
+
+bool UCapturableSoundWave::SetCaptureFrameSize(int32 NumOfFrames)
+{
+	if (NumOfFrames <= 0)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to set the capture frame size for sound wave %s to %d because it must be greater than zero"), *GetName(), NumOfFrames);
+		return false;
+	}
+
+	CaptureFrameSize = NumOfFrames;
+	return true;
+}
+
+FRuntimeAudioCaptureStats UCapturableSoundWave::GetCaptureStats() const
+{
+	FRAIScopeLock Lock(&*DataGuard);
+	FRuntimeAudioCaptureStats Stats = CaptureStats;
+	Stats.NumOfDroppedFrames = NumOfDroppedCaptureFrames.load();
+	Stats.NumOfOverflows = NumOfCaptureOverflows.load();
+	Stats.NumOfBufferOverflows = NumOfCaptureBufferOverflows.load();
+	return Stats;
+}
+
+void UCapturableSoundWave::ResetCaptureStats()
+{
+	FRAIScopeLock Lock(&*DataGuard);
+	CaptureStats = FRuntimeAudioCaptureStats();
+	NumOfDroppedCaptureFrames = 0;
+	NumOfCaptureOverflows = 0;
+	NumOfCaptureBufferOverflows = 0;
+}
+
+void UCapturableSoundWave::ProcessCapturedAudioData(const float* PCMData, int32 NumOfFrames, int32 NumOfChannels, int32 InSampleRate, bool bOverflow)
+{
+	if (!PCMData || NumOfFrames <= 0 || NumOfChannels <= 0 || InSampleRate <= 0 || !CaptureRingBuffer.IsInitialized())
+	{
+		return;
+	}
+
+	if (bOverflow)
+	{
+		++NumOfCaptureOverflows;
+	}
+
+	// The buffered data has to be in the same format, so the data buffered in the previous format is appended first if it changes
+	if ((NumOfChannels != CaptureNumOfChannels || InSampleRate != CaptureSampleRate) && CaptureRingBuffer.Num() > 0)
+	{
+		const bool bCopyAppendedPCMData = IsPopulateAudioDataBound();
+		TArray<float> AppendedPCMData;
+		bool bAppended;
+		{
+			FRAIScopeLock Lock(&*DataGuard);
+			bAppended = AppendCaptureRingBuffer_Internal(bCopyAppendedPCMData ? &AppendedPCMData : nullptr);
+		}
+
+		if (bAppended)
+		{
+			BroadcastPopulatedAudioData(MoveTemp(AppendedPCMData));
+		}
+	}
+	CaptureSampleRate = InSampleRate;
+	CaptureNumOfChannels = NumOfChannels;
+
+	// The ring buffer is sized for the requested frame size, but the device may deliver more frames or channels per callback
+	const uint32 NumOfRequiredSamples = static_cast<uint32>(NumOfFrames) * NumOfChannels * NumOfBufferedCaptureCallbacks;
+	if (CaptureRingBuffer.GetCapacity() < NumOfRequiredSamples)
+	{
+		GrowCaptureRingBuffer(NumOfRequiredSamples);
+	}
+
+	// Only whole frames are buffered, so that the buffered data always stays channel-aligned
+	const int32 NumOfFramesToBuffer = FMath::Min<int32>(NumOfFrames, (CaptureRingBuffer.GetCapacity() - CaptureRingBuffer.Num()) / NumOfChannels);
+	CaptureRingBuffer.Push(PCMData, NumOfFramesToBuffer * NumOfChannels);
+	if (NumOfFramesToBuffer < NumOfFrames)
+	{
+		NumOfDroppedCaptureFrames += NumOfFrames - NumOfFramesToBuffer;
+		++NumOfCaptureBufferOverflows;
+	}
+
+	const bool bCopyAppendedPCMData = IsPopulateAudioDataBound();
+	TArray<float> AppendedPCMData;
+
+	// The buffered data is appended with the next capture callback if the sound wave is busy (e.g. being appended to or released)
+	if (!DataGuard->TryLock())
+	{
+		return;
+	}
+
+	const bool bAppended = AppendCaptureRingBuffer_Internal(bCopyAppendedPCMData ? &AppendedPCMData : nullptr);
+	if (bAppended)
+	{
+		// The most recently captured sample waits for the rest of the capture callback and for the audio data queued ahead of it, including the render prefetch
+		const uint32 NumOfQueuedFrames = PCMBufferInfo->PCMNumOfFrames - FMath::Min<uint32>(GetNumOfPlayedFrames_Internal(), PCMBufferInfo->PCMNumOfFrames) + PCMRingBuffer.Num() / NumChannels;
+		const float Latency = static_cast<float>(NumOfFrames) / InSampleRate + static_cast<float>(NumOfQueuedFrames) / SampleRate;
+
+		++CaptureStats.NumOfCaptureCallbacks;
+		CaptureStats.LastLatency = Latency;
+		CaptureStats.AverageLatency += (Latency - CaptureStats.AverageLatency) / CaptureStats.NumOfCaptureCallbacks;
+		CaptureStats.MaxLatency = FMath::Max(CaptureStats.MaxLatency, Latency);
+	}
+
+	DataGuard->Unlock();
+
+	if (bAppended)
+	{
+		BroadcastPopulatedAudioData(MoveTemp(AppendedPCMData));
+	}
+}
+
+void UCapturableSoundWave::GrowCaptureRingBuffer(uint32 MinNumOfSamples)
+{
+	const uint32 NumOfBufferedSamples = CaptureRingBuffer.Num();
+	DrainedCapturePCMData.SetNumUninitialized(NumOfBufferedSamples);
+	CaptureRingBuffer.Pop(DrainedCapturePCMData.GetData(), NumOfBufferedSamples);
+
+	CaptureRingBuffer.Initialize(MinNumOfSamples);
+	CaptureRingBuffer.Push(DrainedCapturePCMData.GetData(), NumOfBufferedSamples);
+}
+
+bool UCapturableSoundWave::AppendCaptureRingBuffer_Internal(TArray<float>* AppendedPCMData)
+{
+	const uint32 NumOfBufferedSamples = CaptureRingBuffer.Num();
+	if (NumOfBufferedSamples == 0 || CaptureSampleRate <= 0 || CaptureNumOfChannels <= 0)
+	{
+		return false;
+	}
+
+	DrainedCapturePCMData.SetNumUninitialized(NumOfBufferedSamples);
+	CaptureRingBuffer.Pop(DrainedCapturePCMData.GetData(), NumOfBufferedSamples);
+
+	return AppendPCMData_Internal(DrainedCapturePCMData.GetData(), NumOfBufferedSamples, CaptureSampleRate, CaptureNumOfChannels, AppendedPCMData);
+}
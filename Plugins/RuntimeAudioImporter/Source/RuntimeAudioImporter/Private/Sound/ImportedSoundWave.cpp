@@ -14,6 +14,59 @@
 #endif
 #include "Codecs/RAW_RuntimeCodec.h"
 
+namespace
+{
+	/** Number of samples the render ring buffer can hold. Large enough for two render callbacks of 1024 frames with 8 channels */
+	constexpr uint32 PCMRingBufferCapacity = 16384;
+
+	/** Number of frames converted at a time when resampling or mixing the channels of the sound wave, which bounds the size of the intermediate buffers */
+	constexpr int64 ConversionBlockNumOfFrames = 16384;
+
+#if WITH_RUNTIMEAUDIOIMPORTER_METASOUND_SUPPORT
+	/** Size of the header of a canonical PCM WAV file */
+	constexpr int64 PCMWAVHeaderSize = 44;
+
+	/**
+	 * Write the header of a canonical 16-bit PCM WAV file
+	 *
+	 * @param Header Memory with room for PCMWAVHeaderSize bytes
+	 * @param NumOfChannels Number of channels
+	 * @param SampleRate Sample rate
+	 * @param PCMDataSize Size of the 16-bit PCM data following the header, in bytes
+	 */
+	void WritePCM16WAVHeader(uint8* Header, int32 NumOfChannels, int32 SampleRate, uint32 PCMDataSize)
+	{
+		auto WriteUInt32 = [](uint8* Destination, uint32 Value)
+		{
+			Destination[0] = static_cast<uint8>(Value);
+			Destination[1] = static_cast<uint8>(Value >> 8);
+			Destination[2] = static_cast<uint8>(Value >> 16);
+			Destination[3] = static_cast<uint8>(Value >> 24);
+		};
+
+		auto WriteUInt16 = [](uint8* Destination, uint16 Value)
+		{
+			Destination[0] = static_cast<uint8>(Value);
+			Destination[1] = static_cast<uint8>(Value >> 8);
+		};
+
+		FMemory::Memcpy(Header, "RIFF", 4);
+		WriteUInt32(Header + 4, static_cast<uint32>(PCMWAVHeaderSize - 8) + PCMDataSize);
+		FMemory::Memcpy(Header + 8, "WAVE", 4);
+		FMemory::Memcpy(Header + 12, "fmt ", 4);
+		WriteUInt32(Header + 16, 16);
+		WriteUInt16(Header + 20, 1);
+		WriteUInt16(Header + 22, static_cast<uint16>(NumOfChannels));
+		WriteUInt32(Header + 24, static_cast<uint32>(SampleRate));
+		WriteUInt32(Header + 28, static_cast<uint32>(SampleRate) * NumOfChannels * sizeof(int16));
+		WriteUInt16(Header + 32, static_cast<uint16>(NumOfChannels * sizeof(int16)));
+		WriteUInt16(Header + 34, 16);
+		FMemory::Memcpy(Header + 36, "data", 4);
+		WriteUInt32(Header + 40, PCMDataSize);
+	}
+#endif
+}
+
 UImportedSoundWave::UImportedSoundWave(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
   , DataGuard(MakeShared<FCriticalSection>())
@@ -21,9 +74,19 @@ UImportedSoundWave::UImportedSoundWave(const FObjectInitializer& ObjectInitializ
   , PlaybackFinishedBroadcast(false)
   , PlayedNumOfFrames(0)
   , PCMBufferInfo(MakeShared<FPCMStruct>())
+  , bAutoReleasePlayedAudioData(false)
+  , AutoReleaseKeepPlayedDuration(0)
+  , bSharedPCMBuffer(false)
+  , NumOfReleasedFrames(0)
+  , PCMDataRevision(0)
+  , bPCMRingBufferFlushRequested(false)
+  , LastRequestedNumOfSamples(0)
   , bStopSoundOnPlaybackFinish(true)
   , ImportedAudioFormat(ERuntimeAudioFormat::Invalid)
+  , MetaSoundsAudioResourceFormat(NAME_None)
 {
+	bGeneratedPCMDataBroadcastScheduled = false;
+
 	ensure(PCMBufferInfo);
 
 #if UE_VERSION_NEWER_THAN(5, 0, 0)
@@ -91,6 +154,7 @@ void UImportedSoundWave::DuplicateSoundWave(bool bUseSharedAudioBuffer, const FO
 	FRAIScopeLock Lock(&*DataGuard);
 	DuplicatedSoundWave->DurationOffset = DurationOffset;
 	DuplicatedSoundWave->PCMBufferInfo = bUseSharedAudioBuffer ? PCMBufferInfo : MakeShared<FPCMStruct>(*PCMBufferInfo);
+	DuplicatedSoundWave->bSharedPCMBuffer = bUseSharedAudioBuffer && bSharedPCMBuffer;
 	DuplicatedSoundWave->bStopSoundOnPlaybackFinish = bStopSoundOnPlaybackFinish;
 	DuplicatedSoundWave->ImportedAudioFormat = ImportedAudioFormat;
 	DuplicatedSoundWave->Duration = Duration;
@@ -114,22 +178,87 @@ TSharedPtr<Audio::IProxyData> UImportedSoundWave::CreateProxyData(const Audio::F
 	if (SoundWaveDataPtr)
 	{
 		SoundWaveDataPtr->InitializeDataFromSoundWave(*this);
-		SoundWaveDataPtr->OverrideRuntimeFormat(Audio::NAME_OGG);
+
+		// The runtime format must match the data the audio resource was initialized with
+		SoundWaveDataPtr->OverrideRuntimeFormat(MetaSoundsAudioResourceFormat.IsNone() ? Audio::NAME_ADPCM : MetaSoundsAudioResourceFormat);
 	}
 	return USoundWave::CreateProxyData(InitParams);
 }
 
 bool UImportedSoundWave::InitAudioResource(FName Format)
 {
-	// Only OGG format is supported for audio resource initialization
-	if (Format != Audio::NAME_OGG)
+	// ADPCM's decoder also reads uncompressed 16-bit PCM WAV data, which is built from the PCM data without encoding. OGG requires encoding the PCM data to Vorbis
+	if (Format != Audio::NAME_ADPCM && Format != Audio::NAME_OGG)
 	{
-		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("RuntimeAudioImporter does not support audio format '%s' for initialization. Supported format: %s"), *Format.ToString(), *Audio::NAME_OGG.ToString());
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("RuntimeAudioImporter does not support audio format '%s' for initialization. Supported formats: %s, %s"), *Format.ToString(), *Audio::NAME_ADPCM.ToString(), *Audio::NAME_OGG.ToString());
 		return false;
 	}
 
 	if (SoundWaveDataPtr->GetResourceSize() > 0)
 	{
+		if (Format != MetaSoundsAudioResourceFormat)
+		{
+			UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The audio resource of the sound wave '%s' has already been initialized with format '%s', which is kept instead of '%s'"), *GetName(), *MetaSoundsAudioResourceFormat.ToString(), *Format.ToString());
+		}
+		return true;
+	}
+
+	FByteBulkData CompressedBulkData;
+
+	if (Format == Audio::NAME_ADPCM)
+	{
+		TSharedPtr<FPCMStruct> SourcePCMInfo;
+		int32 SourceSampleRate;
+		int32 SourceNumOfChannels;
+		bool bWasSharedPCMBuffer;
+		{
+			FRAIScopeLock Lock(&*DataGuard);
+			SourcePCMInfo = PCMBufferInfo;
+			SourceSampleRate = GetSampleRate();
+			SourceNumOfChannels = GetNumOfChannels();
+			bWasSharedPCMBuffer = bSharedPCMBuffer;
+
+			// Sharing the PCM data for the duration of the transcoding, so that DataGuard is not held meanwhile and the playback is not starved. Any modification in the meantime is made to a copy instead
+			bSharedPCMBuffer = true;
+		}
+
+		auto RestoreSharedPCMBuffer = [this, &SourcePCMInfo, bWasSharedPCMBuffer]()
+		{
+			FRAIScopeLock Lock(&*DataGuard);
+			if (PCMBufferInfo == SourcePCMInfo)
+			{
+				bSharedPCMBuffer = bWasSharedPCMBuffer;
+			}
+		};
+
+		const int64 NumOfSamples = SourcePCMInfo.IsValid() ? SourcePCMInfo->PCMData.GetView().Num() : 0;
+		if (NumOfSamples <= 0 || SourceNumOfChannels <= 0 || SourceSampleRate <= 0)
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to initialize the audio resource of the sound wave '%s' because it has no audio data"), *GetName());
+			RestoreSharedPCMBuffer();
+			return false;
+		}
+
+		const int64 PCMDataSize = NumOfSamples * sizeof(int16);
+		if (PCMDataSize > TNumericLimits<uint32>::Max() - PCMWAVHeaderSize)
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to initialize the audio resource of the sound wave '%s' because its audio data (%lld bytes as 16-bit PCM) does not fit into a WAV file"), *GetName(), PCMDataSize);
+			RestoreSharedPCMBuffer();
+			return false;
+		}
+
+		// Building the WAV data directly from the PCM data, which only needs transcoding to 16-bit rather than encoding
+		CompressedBulkData.Lock(LOCK_READ_WRITE);
+		{
+			uint8* WAVData = static_cast<uint8*>(CompressedBulkData.Realloc(PCMWAVHeaderSize + PCMDataSize));
+			WritePCM16WAVHeader(WAVData, SourceNumOfChannels, SourceSampleRate, static_cast<uint32>(PCMDataSize));
+			FRAW_RuntimeCodec::TranscodeRAWDataIntoBuffer<float, int16>(SourcePCMInfo->PCMData.GetView().GetData(), NumOfSamples, reinterpret_cast<int16*>(WAVData + PCMWAVHeaderSize));
+		}
+		CompressedBulkData.Unlock();
+		RestoreSharedPCMBuffer();
+
+		USoundWave::InitAudioResource(CompressedBulkData);
+		MetaSoundsAudioResourceFormat = Format;
 		return true;
 	}
 
@@ -161,8 +290,6 @@ bool UImportedSoundWave::InitAudioResource(FName Format)
 		return false;
 	}
 
-	FByteBulkData CompressedBulkData;
-
 	// Filling in the compressed data
 	{
 		CompressedBulkData.Lock(LOCK_READ_WRITE);
@@ -171,6 +298,7 @@ bool UImportedSoundWave::InitAudioResource(FName Format)
 	}
 
 	USoundWave::InitAudioResource(CompressedBulkData);
+	MetaSoundsAudioResourceFormat = Format;
 	return true;
 }
 
@@ -183,45 +311,41 @@ bool UImportedSoundWave::IsSeekable() const
 
 int32 UImportedSoundWave::OnGeneratePCMAudio(TArray<uint8>& OutAudio, int32 NumSamples)
 {
-	float* RetrievedPCMDataPtr;
-	{
-		FRAIScopeLock Lock(&*DataGuard);
+	OutAudio.Reset();
 
-		if (!PCMBufferInfo.IsValid())
-		{
-			return 0;
-		}
-
-		// Ensure there is enough number of frames. Lack of frames means audio playback has finished
-		if (GetNumOfPlayedFrames_Internal() >= PCMBufferInfo->PCMNumOfFrames)
-		{
-			return 0;
-		}
-
-		// Getting the remaining number of samples if the required number of samples is greater than the total available number
-		if (GetNumOfPlayedFrames_Internal() + (static_cast<uint32>(NumSamples) / static_cast<uint32>(NumChannels)) >= PCMBufferInfo->PCMNumOfFrames)
-		{
-			NumSamples = (PCMBufferInfo->PCMNumOfFrames - GetNumOfPlayedFrames_Internal()) * NumChannels;
-		}
+	if (!PCMRingBuffer.IsInitialized() || NumSamples <= 0)
+	{
+		return 0;
+	}
 
-		// Retrieving a part of PCM data
-		RetrievedPCMDataPtr = PCMBufferInfo->PCMData.GetView().GetData() + (GetNumOfPlayedFrames_Internal() * NumChannels);
-		const int32 RetrievedPCMDataSize = NumSamples * sizeof(float);
+	// Discarding the prefetched PCM data if the playback position or the PCM data has changed since it was prefetched
+	if (bPCMRingBufferFlushRequested.load(std::memory_order_acquire))
+	{
+		PCMRingBuffer.Pop(nullptr, PCMRingBuffer.Num());
+		bPCMRingBufferFlushRequested.store(false, std::memory_order_release);
+	}
 
-		// Ensure we got a valid PCM data
-		if (RetrievedPCMDataSize <= 0 || !RetrievedPCMDataPtr)
-		{
-			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to get PCM audio from imported sound wave since the retrieved PCM data is invalid"));
-			return 0;
-		}
+	LastRequestedNumOfSamples.store(NumSamples, std::memory_order_relaxed);
 
-		// Filling in OutAudio array with the retrieved PCM data
-		OutAudio = TArray<uint8>(reinterpret_cast<uint8*>(RetrievedPCMDataPtr), RetrievedPCMDataSize);
+	// Topping up the prefetched PCM data. If DataGuard is held elsewhere (e.g. while appending audio data), the already prefetched data is played without waiting
+	if (DataGuard->TryLock())
+	{
+		FillPCMRingBuffer_Internal();
+		DataGuard->Unlock();
+	}
 
-		// Increasing the number of frames played
-		SetNumOfPlayedFrames_Internal(GetNumOfPlayedFrames_Internal() + (NumSamples / NumChannels));
+	// The ring buffer only ever contains whole frames, so no channel alignment is needed here
+	const int32 NumOfSamplesToPop = FMath::Min<int32>(NumSamples, PCMRingBuffer.Num());
+	if (NumOfSamplesToPop <= 0)
+	{
+		return 0;
 	}
 
+	// OutAudio keeps its allocation between render callbacks
+	OutAudio.AddUninitialized(NumOfSamplesToPop * sizeof(float));
+	float* RetrievedPCMDataPtr = reinterpret_cast<float*>(OutAudio.GetData());
+	PCMRingBuffer.Pop(RetrievedPCMDataPtr, NumOfSamplesToPop);
+
 	const bool IsBound = [this]()
 	{
 		FRAIScopeLock Lock(&OnGeneratePCMData_DataGuard);
@@ -229,26 +353,101 @@ int32 UImportedSoundWave::OnGeneratePCMAudio(TArray<uint8>& OutAudio, int32 NumS
 	}();
 	if (IsBound)
 	{
-		TArray<float> PCMData(RetrievedPCMDataPtr, NumSamples);
-		AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this), PCMData = MoveTemp(PCMData)]() mutable
 		{
-			if (WeakThis.IsValid())
+			FScopeLock Lock(&PendingGeneratedPCMData_DataGuard);
+			PendingGeneratedPCMData.Append(RetrievedPCMDataPtr, NumOfSamplesToPop);
+		}
+
+		// Broadcasting once per batch of render callbacks rather than once per callback
+		if (!bGeneratedPCMDataBroadcastScheduled.exchange(true))
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this)]()
 			{
-				FRAIScopeLock Lock(&WeakThis->OnGeneratePCMData_DataGuard);
-				if (WeakThis->OnGeneratePCMDataNative.IsBound())
+				if (WeakThis.IsValid())
 				{
-					WeakThis->OnGeneratePCMDataNative.Broadcast(PCMData);
+					WeakThis->BroadcastGeneratedPCMData();
 				}
+			});
+		}
+	}
 
-				if (WeakThis->OnGeneratePCMData.IsBound())
-				{
-					WeakThis->OnGeneratePCMData.Broadcast(PCMData);
-				}
-			}
-		});
+	return NumOfSamplesToPop;
+}
+
+void UImportedSoundWave::FillPCMRingBuffer_Internal()
+{
+	if (!PCMRingBuffer.IsInitialized() || !PCMBufferInfo.IsValid() || NumChannels <= 0)
+	{
+		return;
+	}
+
+	// The consumer has not discarded the outdated data yet, pushing now would get the new data discarded as well
+	if (bPCMRingBufferFlushRequested.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	if (GetNumOfPlayedFrames_Internal() >= PCMBufferInfo->PCMNumOfFrames)
+	{
+		return;
+	}
+
+	// Prefetching two render callbacks ahead keeps the reported playback position close to what is actually heard
+	const uint32 TargetNumOfSamples = FMath::Min<uint32>(PCMRingBuffer.GetCapacity(), static_cast<uint32>(LastRequestedNumOfSamples.load(std::memory_order_relaxed)) * 2);
+	const uint32 NumOfBufferedSamples = PCMRingBuffer.Num();
+	if (NumOfBufferedSamples >= TargetNumOfSamples)
+	{
+		return;
+	}
+
+	const uint32 NumOfFramesToPush = FMath::Min<uint32>((TargetNumOfSamples - NumOfBufferedSamples) / NumChannels, PCMBufferInfo->PCMNumOfFrames - GetNumOfPlayedFrames_Internal());
+	if (NumOfFramesToPush == 0)
+	{
+		return;
+	}
+
+	const float* PCMDataPtr = PCMBufferInfo->PCMData.GetView().GetData() + (static_cast<int64>(GetNumOfPlayedFrames_Internal()) * NumChannels);
+	const uint32 NumOfPushedSamples = PCMRingBuffer.Push(PCMDataPtr, NumOfFramesToPush * NumChannels);
+
+	PlayedNumOfFrames += NumOfPushedSamples / NumChannels;
+}
+
+void UImportedSoundWave::RequestPCMRingBufferFlush_Internal()
+{
+	PlayedNumOfFrames = GetNumOfRenderedFrames_Internal();
+	bPCMRingBufferFlushRequested.store(true, std::memory_order_release);
+}
+
+void UImportedSoundWave::BroadcastGeneratedPCMData()
+{
+	check(IsInGameThread());
+
+	// Clearing the flag before swapping, so that data appended after the swap schedules another broadcast
+	bGeneratedPCMDataBroadcastScheduled.store(false);
+	{
+		FScopeLock Lock(&PendingGeneratedPCMData_DataGuard);
+		Swap(PendingGeneratedPCMData, BroadcastingGeneratedPCMData);
+	}
+
+	if (BroadcastingGeneratedPCMData.Num() == 0)
+	{
+		return;
+	}
+
+	{
+		FRAIScopeLock Lock(&OnGeneratePCMData_DataGuard);
+		if (OnGeneratePCMDataNative.IsBound())
+		{
+			OnGeneratePCMDataNative.Broadcast(BroadcastingGeneratedPCMData);
+		}
+
+		if (OnGeneratePCMData.IsBound())
+		{
+			OnGeneratePCMData.Broadcast(BroadcastingGeneratedPCMData);
+		}
 	}
 
-	return NumSamples;
+	BroadcastingGeneratedPCMData.Reset();
 }
 
 void UImportedSoundWave::BeginDestroy()
@@ -262,6 +461,12 @@ void UImportedSoundWave::Parse(FAudioDevice* AudioDevice, const UPTRINT NodeWave
 {
 	FRAIScopeLock Lock(&*DataGuard);
 
+	// Allocating the render ring buffer before the sound generates any audio, so the render thread never allocates
+	if (!PCMRingBuffer.IsInitialized())
+	{
+		PCMRingBuffer.Initialize(PCMRingBufferCapacity);
+	}
+
 	if (ActiveSound.PlaybackTime == 0.f)
 	{
 		UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The playback time for the sound wave '%s' will be set to '%f'"), *GetName(), ParseParams.StartTime);
@@ -334,6 +539,8 @@ void UImportedSoundWave::PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&&
 {
 	FRAIScopeLock Lock(&*DataGuard);
 
+	RequestPCMRingBufferFlush_Internal();
+
 	const FString DecodedAudioInfoString = DecodedAudioInfo.ToString();
 
 	Duration = DecodedAudioInfo.SoundWaveBasicInfo.Duration;
@@ -344,8 +551,10 @@ void UImportedSoundWave::PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&&
 	NumChannels = DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels;
 	ImportedAudioFormat = DecodedAudioInfo.SoundWaveBasicInfo.AudioFormat;
 
+	DetachSharedPCMBuffer_Internal(false);
 	PCMBufferInfo->PCMData = MoveTemp(DecodedAudioInfo.PCMInfo.PCMData);
 	PCMBufferInfo->PCMNumOfFrames = DecodedAudioInfo.PCMInfo.PCMNumOfFrames;
+	++PCMDataRevision;
 
 	{
 		const bool IsBound = [this]()
@@ -405,6 +614,44 @@ void UImportedSoundWave::PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&&
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The audio data has been populated successfully. Information about audio data:\n%s"), *DecodedAudioInfoString);
 }
 
+void UImportedSoundWave::PopulateAudioDataFromSharedPCM(const FSoundWaveBasicStruct& SoundWaveBasicInfo, TSharedPtr<FPCMStruct> SharedPCMInfo)
+{
+	if (!SharedPCMInfo.IsValid())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to populate the sound wave '%s' from shared PCM data because the PCM data is invalid"), *GetName());
+		return;
+	}
+
+	FRAIScopeLock Lock(&*DataGuard);
+
+	RequestPCMRingBufferFlush_Internal();
+
+	Duration = SoundWaveBasicInfo.Duration;
+#if UE_VERSION_NEWER_THAN(5, 0, 0)
+	SetImportedSampleRate(0);
+#endif
+	SetSampleRate(SoundWaveBasicInfo.SampleRate);
+	NumChannels = SoundWaveBasicInfo.NumOfChannels;
+	ImportedAudioFormat = SoundWaveBasicInfo.AudioFormat;
+
+	PCMBufferInfo = MoveTemp(SharedPCMInfo);
+	bSharedPCMBuffer = true;
+	++PCMDataRevision;
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The audio data has been populated from shared PCM data successfully. Information about audio data:\n%s"), *SoundWaveBasicInfo.ToString());
+}
+
+void UImportedSoundWave::DetachSharedPCMBuffer_Internal(bool bCopyPCMData)
+{
+	if (!bSharedPCMBuffer)
+	{
+		return;
+	}
+
+	PCMBufferInfo = bCopyPCMData ? MakeShared<FPCMStruct>(*PCMBufferInfo) : MakeShared<FPCMStruct>();
+	bSharedPCMBuffer = false;
+}
+
 void UImportedSoundWave::PrepareSoundWaveForMetaSounds(const FOnPrepareSoundWaveForMetaSoundsResult& Result)
 {
 	PrepareSoundWaveForMetaSounds(FOnPrepareSoundWaveForMetaSoundsResultNative::CreateWeakLambda(this, [Result](bool bSucceeded)
@@ -433,7 +680,7 @@ void UImportedSoundWave::PrepareSoundWaveForMetaSounds(const FOnPrepareSoundWave
 		});
 	};
 
-	const bool bSucceeded = InitAudioResource(Audio::NAME_OGG);
+	const bool bSucceeded = InitAudioResource(Audio::NAME_ADPCM);
 	if (bSucceeded)
 	{
 		UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully prepared the sound wave '%s' for MetaSounds"), *GetName());
@@ -455,9 +702,12 @@ void UImportedSoundWave::ReleaseMemory()
 {
 	FRAIScopeLock Lock(&*DataGuard);
 	UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Releasing memory for the sound wave '%s'"), *GetName());
+	RequestPCMRingBufferFlush_Internal();
+	DetachSharedPCMBuffer_Internal(false);
 	PCMBufferInfo->PCMData.Empty();
 	PCMBufferInfo->PCMNumOfFrames = 0;
 	Duration = 0;
+	++PCMDataRevision;
 }
 
 void UImportedSoundWave::ReleasePlayedAudioData(const FOnPlayedAudioDataReleaseResult& Result)
@@ -496,7 +746,9 @@ void UImportedSoundWave::ReleasePlayedAudioData(const FOnPlayedAudioDataReleaseR
 		});
 	};
 
-	if (GetNumOfPlayedFrames_Internal() == 0)
+	// Frames still waiting in the render ring buffer have not been heard yet, so only the rendered frames count as played here
+	const uint32 NumOfRenderedFrames = GetNumOfRenderedFrames_Internal();
+	if (NumOfRenderedFrames == 0)
 	{
 		UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("No audio data will be released because the current playback time is zero"));
 		ExecuteResult(false);
@@ -504,7 +756,7 @@ void UImportedSoundWave::ReleasePlayedAudioData(const FOnPlayedAudioDataReleaseR
 	}
 
 	const int64 OldNumOfPCMData = PCMBufferInfo->PCMData.GetView().Num();
-	if (GetNumOfPlayedFrames_Internal() >= PCMBufferInfo->PCMNumOfFrames)
+	if (NumOfRenderedFrames >= PCMBufferInfo->PCMNumOfFrames)
 	{
 		ReleaseMemory();
 		UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully released all PCM data (%lld)"), OldNumOfPCMData);
@@ -512,35 +764,61 @@ void UImportedSoundWave::ReleasePlayedAudioData(const FOnPlayedAudioDataReleaseR
 		return;
 	}
 
-	const int64 NewPCMDataSize = (PCMBufferInfo->PCMNumOfFrames - GetNumOfPlayedFrames_Internal()) * NumChannels;
-	float* NewPCMDataPtr = static_cast<float*>(FMemory::Malloc(NewPCMDataSize * sizeof(float)));
-	if (!NewPCMDataPtr)
+	ReleasePlayedFrames_Internal(NumOfRenderedFrames);
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully released %lld number of PCM data"), static_cast<int64>(OldNumOfPCMData - PCMBufferInfo->PCMData.GetView().Num()));
+	ExecuteResult(true);
+}
+
+void UImportedSoundWave::SetAutoReleasePlayedAudioData(bool bEnable, float KeepPlayedDuration)
+{
+	FRAIScopeLock Lock(&*DataGuard);
+
+	bAutoReleasePlayedAudioData = bEnable;
+	AutoReleaseKeepPlayedDuration = FMath::Max<float>(KeepPlayedDuration, 0);
+}
+
+void UImportedSoundWave::ReleasePlayedFrames_Internal(uint32 NumOfFramesToRelease)
+{
+	// Only the frames already consumed by the mixer can be released, the prefetched ones may still be discarded by a flush and pushed again
+	NumOfFramesToRelease = FMath::Min<uint32>(NumOfFramesToRelease, GetNumOfRenderedFrames_Internal());
+	if (NumOfFramesToRelease == 0 || !PCMBufferInfo.IsValid() || NumChannels <= 0 || SampleRate <= 0)
 	{
-		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate new memory to free already played audio data"));
-		ExecuteResult(false);
 		return;
 	}
 
-	// PCM data offset to retrieve remaining data for playback
-	const int64 PCMDataOffset = GetNumOfPlayedFrames_Internal() * NumChannels;
-
-	FMemory::Memcpy(NewPCMDataPtr, PCMBufferInfo->PCMData.GetView().GetData() + PCMDataOffset, NewPCMDataSize * sizeof(float));
-	PCMBufferInfo->PCMData = FRuntimeBulkDataBuffer<float>(NewPCMDataPtr, NewPCMDataSize);
+	// Advancing the start of the PCM data past the released frames. The remaining data is not copied, so the release cost does not depend on the amount of audio data accumulated so far
+	// The PCM data remains contiguous, and the frames already prefetched into the render ring buffer stay valid
+	DetachSharedPCMBuffer_Internal(true);
+	PCMBufferInfo->PCMData.RemoveFromStart(static_cast<int64>(NumOfFramesToRelease) * NumChannels);
 
 	// Decreasing the amount of PCM frames
-	PCMBufferInfo->PCMNumOfFrames -= GetNumOfPlayedFrames_Internal();
+	PCMBufferInfo->PCMNumOfFrames -= NumOfFramesToRelease;
+	PlayedNumOfFrames -= NumOfFramesToRelease;
+	NumOfReleasedFrames += NumOfFramesToRelease;
 
 	// Decreasing duration and increasing duration offset
 	{
-		const float DurationOffsetToReduce = GetPlaybackTime_Internal();
+		const float DurationOffsetToReduce = static_cast<float>(NumOfFramesToRelease) / SampleRate;
 		Duration -= DurationOffsetToReduce;
 		DurationOffset += DurationOffsetToReduce;
 	}
+}
 
-	PlayedNumOfFrames = 0;
+void UImportedSoundWave::AutoReleasePlayedAudioData_Internal()
+{
+	// Looping playback returns to the start of the PCM data, so no played data can be released
+	if (!bAutoReleasePlayedAudioData || bLooping || SampleRate <= 0)
+	{
+		return;
+	}
 
-	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully released %lld number of PCM data"), static_cast<int64>(OldNumOfPCMData - PCMBufferInfo->PCMData.GetView().Num()));
-	ExecuteResult(true);
+	const uint32 NumOfFramesToKeep = static_cast<uint32>(FMath::Min<double>(static_cast<double>(AutoReleaseKeepPlayedDuration) * SampleRate, TNumericLimits<uint32>::Max()));
+	const uint32 NumOfRenderedFrames = GetNumOfRenderedFrames_Internal();
+	if (NumOfRenderedFrames > NumOfFramesToKeep)
+	{
+		ReleasePlayedFrames_Internal(NumOfRenderedFrames - NumOfFramesToKeep);
+	}
 }
 
 void UImportedSoundWave::SetLooping(bool bLoop)
@@ -605,24 +883,48 @@ bool UImportedSoundWave::ResampleSoundWave(int32 NewSampleRate)
 		return false;
 	}
 
-	FRAIScopeLock Lock(&*DataGuard);
-
-	Audio::FAlignedFloatBuffer NewPCMData;
-	Audio::FAlignedFloatBuffer SourcePCMData = Audio::FAlignedFloatBuffer(PCMBufferInfo->PCMData.GetView().GetData(), PCMBufferInfo->PCMData.GetView().Num());
-
-	if (!FRAW_RuntimeCodec::ResampleRAWData(SourcePCMData, GetNumOfChannels(), GetSampleRate(), NewSampleRate, NewPCMData))
+	const int32 OldSampleRate = GetSampleRate();
+	if (!ConvertSoundWave_Internal(NewSampleRate, GetNumOfChannels()))
 	{
-		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to resample the imported sound wave '%s' from sample rate '%d' to sample rate '%d'"), *GetName(), GetSampleRate(), NewSampleRate);
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to resample the imported sound wave '%s' from sample rate '%d' to sample rate '%d'"), *GetName(), OldSampleRate, NewSampleRate);
 		return false;
 	}
 
-	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully resampled the imported sound wave '%s' from sample rate '%d' to sample rate '%d'"), *GetName(), GetSampleRate(), NewSampleRate);
-	SampleRate = NewSampleRate;
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully resampled the imported sound wave '%s' from sample rate '%d' to sample rate '%d'"), *GetName(), OldSampleRate, NewSampleRate);
+	return true;
+}
+
+void UImportedSoundWave::ResampleSoundWaveAsync(int32 NewSampleRate, const FOnSoundWaveConversionResult& Result)
+{
+	ResampleSoundWaveAsync(NewSampleRate, FOnSoundWaveConversionResultNative::CreateWeakLambda(this, [Result](bool bSucceeded)
+	{
+		Result.ExecuteIfBound(bSucceeded);
+	}));
+}
+
+void UImportedSoundWave::ResampleSoundWaveAsync(int32 NewSampleRate, const FOnSoundWaveConversionResultNative& Result)
+{
+	if (IsInGameThread())
 	{
-		PCMBufferInfo->PCMNumOfFrames = NewPCMData.Num() / GetNumOfChannels();
-		PCMBufferInfo->PCMData = FRuntimeBulkDataBuffer<float>(NewPCMData);
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [WeakThis = MakeWeakObjectPtr(this), NewSampleRate, Result]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->ResampleSoundWaveAsync(NewSampleRate, Result);
+			}
+			else
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to resample the sound wave because it has been destroyed"));
+			}
+		});
+		return;
 	}
-	return true;
+
+	const bool bSucceeded = ResampleSoundWave(NewSampleRate);
+	AsyncTask(ENamedThreads::GameThread, [Result, bSucceeded]()
+	{
+		Result.ExecuteIfBound(bSucceeded);
+	});
 }
 
 bool UImportedSoundWave::MixSoundWaveChannels(int32 NewNumOfChannels)
@@ -639,24 +941,166 @@ bool UImportedSoundWave::MixSoundWaveChannels(int32 NewNumOfChannels)
 		return false;
 	}
 
-	FRAIScopeLock Lock(&*DataGuard);
+	const int32 OldNumOfChannels = GetNumOfChannels();
+	if (!ConvertSoundWave_Internal(GetSampleRate(), NewNumOfChannels))
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to mix the imported sound wave '%s' from number of channels '%d' to number of channels '%d'"), *GetName(), OldNumOfChannels, NewNumOfChannels);
+		return false;
+	}
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully mixed the imported sound wave '%s' from number of channels '%d' to number of channels '%d'"), *GetName(), OldNumOfChannels, NewNumOfChannels);
+	return true;
+}
+
+void UImportedSoundWave::MixSoundWaveChannelsAsync(int32 NewNumOfChannels, const FOnSoundWaveConversionResult& Result)
+{
+	MixSoundWaveChannelsAsync(NewNumOfChannels, FOnSoundWaveConversionResultNative::CreateWeakLambda(this, [Result](bool bSucceeded)
+	{
+		Result.ExecuteIfBound(bSucceeded);
+	}));
+}
 
-	Audio::FAlignedFloatBuffer NewPCMData;
-	Audio::FAlignedFloatBuffer SourcePCMData = Audio::FAlignedFloatBuffer(PCMBufferInfo->PCMData.GetView().GetData(), PCMBufferInfo->PCMData.GetView().Num());
+void UImportedSoundWave::MixSoundWaveChannelsAsync(int32 NewNumOfChannels, const FOnSoundWaveConversionResultNative& Result)
+{
+	if (IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [WeakThis = MakeWeakObjectPtr(this), NewNumOfChannels, Result]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->MixSoundWaveChannelsAsync(NewNumOfChannels, Result);
+			}
+			else
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to mix the sound wave channels because the sound wave has been destroyed"));
+			}
+		});
+		return;
+	}
 
-	if (!FRAW_RuntimeCodec::MixChannelsRAWData(SourcePCMData, GetSampleRate(), GetNumOfChannels(), NewNumOfChannels, NewPCMData))
+	const bool bSucceeded = MixSoundWaveChannels(NewNumOfChannels);
+	AsyncTask(ENamedThreads::GameThread, [Result, bSucceeded]()
 	{
-		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to mix the imported sound wave '%s' from number of channels '%d' to number of channels '%d'"), *GetName(), GetNumOfChannels(), NewNumOfChannels);
+		Result.ExecuteIfBound(bSucceeded);
+	});
+}
+
+bool UImportedSoundWave::ConvertSoundWave_Internal(int32 NewSampleRate, int32 NewNumOfChannels)
+{
+	int32 SourceSampleRate;
+	int32 SourceNumOfChannels;
+	uint32 SourcePCMDataRevision;
+	uint64 BaseNumOfReleasedFrames;
+	int64 NumOfSourceFrames;
+	{
+		FRAIScopeLock Lock(&*DataGuard);
+		SourceSampleRate = GetSampleRate();
+		SourceNumOfChannels = GetNumOfChannels();
+		SourcePCMDataRevision = PCMDataRevision;
+		BaseNumOfReleasedFrames = NumOfReleasedFrames;
+		NumOfSourceFrames = PCMBufferInfo.IsValid() ? PCMBufferInfo->PCMNumOfFrames : 0;
+	}
+
+	if (SourceSampleRate <= 0 || SourceNumOfChannels <= 0)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to convert the imported sound wave '%s' because it has an invalid sample rate '%d' or number of channels '%d'"), *GetName(), SourceSampleRate, SourceNumOfChannels);
 		return false;
 	}
 
-	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully mixed the imported sound wave '%s' from number of channels '%d' to number of channels '%d'"), *GetName(), GetNumOfChannels(), NewNumOfChannels);
-	NumChannels = NewNumOfChannels;
+	// Reserving the expected size up front, so the converted PCM data is allocated once rather than grown, unless audio data is appended during the conversion
+	FRuntimeBulkDataBuffer<float> ConvertedPCMData;
+	ConvertedPCMData.Reserve((static_cast<int64>(FMath::CeilToDouble(static_cast<double>(NumOfSourceFrames) * NewSampleRate / SourceSampleRate)) + 1) * NewNumOfChannels);
+
+	// Converting in bounded blocks, so only the converted PCM data is allocated in full rather than intermediate copies of the whole PCM data
+	// Each block is copied out under DataGuard and converted without it. The blocks continue past the initial end of the PCM data to cover the audio data appended in the meantime
+	FRuntimeStreamingResampler Resampler;
+	Audio::FAlignedFloatBuffer SourceBlockPCMData;
+	Audio::FAlignedFloatBuffer ConvertedBlockPCMData;
+
+	// Number of source frames converted so far, counted from the start of the PCM data once BaseNumOfReleasedFrames frames were released
+	int64 NumOfConvertedSourceFrames = 0;
+
+	while (true)
 	{
-		PCMBufferInfo->PCMNumOfFrames = NewPCMData.Num() / GetNumOfChannels();
-		PCMBufferInfo->PCMData = FRuntimeBulkDataBuffer<float>(NewPCMData);
+		{
+			FRAIScopeLock Lock(&*DataGuard);
+
+			if (PCMDataRevision != SourcePCMDataRevision || GetSampleRate() != SourceSampleRate || GetNumOfChannels() != SourceNumOfChannels)
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to replace the PCM data of the imported sound wave '%s' with the converted one because it was replaced during the conversion"), *GetName());
+				return false;
+			}
+
+			// Dropping the converted frames of the played audio data released since the previous block
+			const int64 NumOfNewlyReleasedFrames = static_cast<int64>(NumOfReleasedFrames - BaseNumOfReleasedFrames);
+			if (NumOfNewlyReleasedFrames > 0)
+			{
+				if (NumOfNewlyReleasedFrames >= NumOfConvertedSourceFrames)
+				{
+					// Everything converted so far has been released, so the conversion starts over from the current start of the PCM data
+					ConvertedPCMData.RemoveFromStart(ConvertedPCMData.GetView().Num());
+					Resampler.Reset();
+					NumOfConvertedSourceFrames = 0;
+				}
+				else
+				{
+					const int64 NumOfFramesToDrop = FMath::Min<int64>(static_cast<int64>(static_cast<double>(NumOfNewlyReleasedFrames) * NewSampleRate / SourceSampleRate + 0.5), ConvertedPCMData.GetView().Num() / NewNumOfChannels);
+					ConvertedPCMData.RemoveFromStart(NumOfFramesToDrop * NewNumOfChannels);
+					NumOfConvertedSourceFrames -= NumOfNewlyReleasedFrames;
+				}
+				BaseNumOfReleasedFrames = NumOfReleasedFrames;
+			}
+
+			const int64 NumOfBlockFrames = FMath::Min<int64>(ConversionBlockNumOfFrames, static_cast<int64>(PCMBufferInfo->PCMNumOfFrames) - NumOfConvertedSourceFrames);
+			if (NumOfBlockFrames <= 0)
+			{
+				// Everything is converted. Flushing the held back frames and replacing the PCM data without releasing DataGuard, so nothing can be appended in between
+				if (!Resampler.Flush(ConvertedBlockPCMData))
+				{
+					return false;
+				}
+
+				if (!ConvertedPCMData.Append(ConvertedBlockPCMData.GetData(), ConvertedBlockPCMData.Num()))
+				{
+					UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate memory for the converted PCM data of the imported sound wave '%s'"), *GetName());
+					return false;
+				}
+
+				// Flushing first, so that the prefetched frames that were never heard are not counted as played when remapping the playback position
+				RequestPCMRingBufferFlush_Internal();
+				const uint32 NumOfPlayedFrames = GetNumOfPlayedFrames_Internal();
+
+				SampleRate = NewSampleRate;
+				NumChannels = NewNumOfChannels;
+				DetachSharedPCMBuffer_Internal(false);
+				{
+					PCMBufferInfo->PCMNumOfFrames = ConvertedPCMData.GetView().Num() / NewNumOfChannels;
+					PCMBufferInfo->PCMData = MoveTemp(ConvertedPCMData);
+				}
+				++PCMDataRevision;
+
+				// Keeping the playback position at the same time
+				PlayedNumOfFrames = FMath::Min<uint32>(static_cast<uint32>(static_cast<double>(NumOfPlayedFrames) * NewSampleRate / SourceSampleRate), PCMBufferInfo->PCMNumOfFrames);
+				return true;
+			}
+
+			SourceBlockPCMData.SetNumUninitialized(NumOfBlockFrames * SourceNumOfChannels);
+			FMemory::Memcpy(SourceBlockPCMData.GetData(), PCMBufferInfo->PCMData.GetView().GetData() + NumOfConvertedSourceFrames * SourceNumOfChannels, SourceBlockPCMData.Num() * sizeof(float));
+		}
+
+		if (!Resampler.ProcessChunk(SourceBlockPCMData.GetData(), SourceBlockPCMData.Num(), SourceSampleRate, SourceNumOfChannels, NewSampleRate, NewNumOfChannels, ERuntimeResamplingQuality::BestSinc, ConvertedBlockPCMData))
+		{
+			return false;
+		}
+
+		if (!ConvertedPCMData.Append(ConvertedBlockPCMData.GetData(), ConvertedBlockPCMData.Num()))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate memory for the converted PCM data of the imported sound wave '%s'"), *GetName());
+			return false;
+		}
+
+		NumOfConvertedSourceFrames += NumOfBlockFrames;
 	}
-	return true;
 }
 
 bool UImportedSoundWave::SetNumOfPlayedFrames(uint32 NumOfFrames)
@@ -673,6 +1117,7 @@ bool UImportedSoundWave::SetNumOfPlayedFrames_Internal(uint32 NumOfFrames)
 		return false;
 	}
 
+	RequestPCMRingBufferFlush_Internal();
 	PlayedNumOfFrames = NumOfFrames;
 
 	ResetPlaybackFinish();
@@ -691,6 +1136,18 @@ uint32 UImportedSoundWave::GetNumOfPlayedFrames_Internal() const
 	return PlayedNumOfFrames;
 }
 
+uint32 UImportedSoundWave::GetNumOfRenderedFrames_Internal() const
+{
+	// Frames pending a flush are going to be discarded, and PlayedNumOfFrames already points past the frames that were rendered
+	if (NumChannels <= 0 || bPCMRingBufferFlushRequested.load(std::memory_order_acquire))
+	{
+		return PlayedNumOfFrames;
+	}
+
+	const uint32 NumOfPrefetchedFrames = PCMRingBuffer.Num() / NumChannels;
+	return PlayedNumOfFrames - FMath::Min<uint32>(NumOfPrefetchedFrames, PlayedNumOfFrames);
+}
+
 float UImportedSoundWave::GetPlaybackTime() const
 {
 	FRAIScopeLock Lock(&*DataGuard);
@@ -699,12 +1156,13 @@ float UImportedSoundWave::GetPlaybackTime() const
 
 float UImportedSoundWave::GetPlaybackTime_Internal() const
 {
-	if (GetNumOfPlayedFrames() == 0 || SampleRate <= 0)
+	const uint32 NumOfRenderedFrames = GetNumOfRenderedFrames_Internal();
+	if (NumOfRenderedFrames == 0 || SampleRate <= 0)
 	{
 		return 0;
 	}
 
-	return static_cast<float>(GetNumOfPlayedFrames()) / SampleRate;
+	return static_cast<float>(NumOfRenderedFrames) / SampleRate;
 }
 
 float UImportedSoundWave::GetDurationConst() const
@@ -746,12 +1204,13 @@ float UImportedSoundWave::GetPlaybackPercentage() const
 {
 	FRAIScopeLock Lock(&*DataGuard);
 
-	if (GetNumOfPlayedFrames_Internal() == 0 || PCMBufferInfo->PCMNumOfFrames == 0)
+	const uint32 NumOfRenderedFrames = GetNumOfRenderedFrames_Internal();
+	if (NumOfRenderedFrames == 0 || PCMBufferInfo->PCMNumOfFrames == 0)
 	{
 		return 0;
 	}
 
-	return static_cast<float>(GetNumOfPlayedFrames_Internal()) / PCMBufferInfo->PCMNumOfFrames * 100;
+	return static_cast<float>(NumOfRenderedFrames) / PCMBufferInfo->PCMNumOfFrames * 100;
 }
 
 bool UImportedSoundWave::IsPlaybackFinished() const
@@ -814,7 +1273,10 @@ bool UImportedSoundWave::IsPlaybackFinished_Internal() const
 	// Is PCM data valid
 	const bool bValidPCMData = PCMBufferInfo.IsValid();
 
-	return bOutOfFrames && bValidPCMData;
+	// Frames prefetched for the render thread are counted as played but have not been heard yet
+	const bool bPrefetchedFramesPlayed = PCMRingBuffer.Num() == 0 || bPCMRingBufferFlushRequested.load(std::memory_order_acquire);
+
+	return bOutOfFrames && bValidPCMData && bPrefetchedFramesPlayed;
 }
 
 bool UImportedSoundWave::GetAudioHeaderInfo(FRuntimeAudioHeaderInfo& HeaderInfo) const
@@ -29,11 +29,13 @@ UStreamingSoundWave::UStreamingSoundWave(const FObjectInitializer& ObjectInitial
 	}
 
 	bFilledInitialAudioData = true;
-	NumOfPreAllocatedByteData = 0;
+	ResamplingQuality = ERuntimeResamplingQuality::BestSinc;
 }
 
 void UStreamingSoundWave::PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&& DecodedAudioInfo)
 {
+	const bool bCopyAppendedPCMData = IsPopulateAudioDataBound();
+	TArray<float> AppendedPCMData;
 	{
 		FRAIScopeLock Lock(&*DataGuard);
 		if (!DecodedAudioInfo.IsValid())
@@ -42,108 +44,146 @@ void UStreamingSoundWave::PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&&
 			return;
 		}
 
-		// Update the initial audio data if it hasn't already been filled in
-		if (!bFilledInitialAudioData)
+		if (!AppendPCMData_Internal(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData(), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num(), DecodedAudioInfo.SoundWaveBasicInfo.SampleRate, DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels, bCopyAppendedPCMData ? &AppendedPCMData : nullptr))
 		{
-			SetSampleRate(DecodedAudioInfo.SoundWaveBasicInfo.SampleRate);
-			NumChannels = DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels;
-			bFilledInitialAudioData = true;
+			return;
 		}
+	}
 
-		// Check if the number of channels and the sampling rate of the sound wave and the input audio data match
-		if (SampleRate != DecodedAudioInfo.SoundWaveBasicInfo.SampleRate || NumChannels != DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels)
-		{
-			Audio::FAlignedFloatBuffer WaveData(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData(), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num());
+	BroadcastPopulatedAudioData(MoveTemp(AppendedPCMData));
 
-			// Resampling if needed
-			if (SampleRate != DecodedAudioInfo.SoundWaveBasicInfo.SampleRate)
-			{
-				Audio::FAlignedFloatBuffer ResamplerOutputData;
-				if (!FRAW_RuntimeCodec::ResampleRAWData(WaveData, GetNumOfChannels(), GetSampleRate(), DecodedAudioInfo.SoundWaveBasicInfo.SampleRate, ResamplerOutputData))
-				{
-					UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to resample audio data to the sound wave's sample rate. Resampling failed"));
-					return;
-				}
-				WaveData = MoveTemp(ResamplerOutputData);
-			}
+	AppendAudioTaskQueue.Pop();
+	if (FAudioTaskDelegate* AppendAudioTask = AppendAudioTaskQueue.Peek())
+	{
+		AppendAudioTask->ExecuteIfBound();
+	}
 
-			// Mixing the channels if needed
-			if (NumChannels != DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels)
-			{
-				Audio::FAlignedFloatBuffer WaveDataTemp;
-				if (!FRAW_RuntimeCodec::MixChannelsRAWData(WaveData, DecodedAudioInfo.SoundWaveBasicInfo.SampleRate, GetNumOfChannels(), DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels, WaveDataTemp))
-				{
-					UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to mix audio data to the sound wave's number of channels. Mixing failed"));
-					return;
-				}
-				WaveData = MoveTemp(WaveDataTemp);
-			}
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully added audio data to streaming sound wave.\nAdded audio info: %s"), *DecodedAudioInfo.ToString());
+}
 
-			DecodedAudioInfo.PCMInfo.PCMData = FRuntimeBulkDataBuffer<float>(WaveData);
+bool UStreamingSoundWave::AppendPCMData(const float* PCMData, int64 NumOfSamples, int32 InSampleRate, int32 InNumOfChannels, bool bEndOfStream)
+{
+	const bool bCopyAppendedPCMData = IsPopulateAudioDataBound();
+	TArray<float> AppendedPCMData;
+	{
+		FRAIScopeLock Lock(&*DataGuard);
+		if (!AppendPCMData_Internal(PCMData, NumOfSamples, InSampleRate, InNumOfChannels, bCopyAppendedPCMData ? &AppendedPCMData : nullptr, bEndOfStream))
+		{
+			return false;
 		}
+	}
+
+	BroadcastPopulatedAudioData(MoveTemp(AppendedPCMData));
+	return true;
+}
 
-		// Do not reallocate the entire PCM buffer if it has free space to fill in
-		if (static_cast<uint64>(NumOfPreAllocatedByteData) >= DecodedAudioInfo.PCMInfo.PCMData.GetView().Num() * sizeof(float))
+bool UStreamingSoundWave::AppendPCMData_Internal(const float* PCMData, int64 NumOfSamples, int32 InSampleRate, int32 InNumOfChannels, TArray<float>* AppendedPCMData, bool bEndOfStream)
+{
+	// Update the initial audio data if it hasn't already been filled in
+	if (!bFilledInitialAudioData)
+	{
+		SetSampleRate(InSampleRate);
+		NumChannels = InNumOfChannels;
+		bFilledInitialAudioData = true;
+	}
+
+	const float* PCMDataToAppend = PCMData;
+	int64 NumOfSamplesToAppend = NumOfSamples;
+
+	// Check if the number of channels and the sampling rate of the sound wave and the input audio data match
+	if (SampleRate != InSampleRate || NumChannels != InNumOfChannels)
+	{
+		// Resampling and mixing the channels as a continuation of the previously appended audio data, so there are no clicks at the chunk boundaries
+		if (!StreamingResampler.ProcessChunk(PCMData, NumOfSamples, InSampleRate, InNumOfChannels, GetSampleRate(), GetNumOfChannels(), ResamplingQuality, ConvertedPCMData, bEndOfStream))
 		{
-			// This should be changed somehow to work with the new calculations
-			FMemory::Memcpy(reinterpret_cast<uint8*>(PCMBufferInfo->PCMData.GetView().GetData()) + ((PCMBufferInfo->PCMData.GetView().Num() * sizeof(float)) - NumOfPreAllocatedByteData), DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData(), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num() * sizeof(float));
-			NumOfPreAllocatedByteData -= DecodedAudioInfo.PCMInfo.PCMData.GetView().Num() * sizeof(float);
-			NumOfPreAllocatedByteData = NumOfPreAllocatedByteData < 0 ? 0 : NumOfPreAllocatedByteData;
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to convert audio data with sample rate %d and %d channels to the sound wave's sample rate %d and %d channels"), InSampleRate, InNumOfChannels, GetSampleRate(), GetNumOfChannels());
+			return false;
 		}
-		else
-		{
-			const int64 NewPCMDataSize = ((PCMBufferInfo->PCMData.GetView().Num() * sizeof(float)) + (DecodedAudioInfo.PCMInfo.PCMData.GetView().Num() * sizeof(float)) - NumOfPreAllocatedByteData) / sizeof(float);
-			float* NewPCMDataPtr = static_cast<float*>(FMemory::Malloc(NewPCMDataSize * sizeof(float)));
 
-			if (!NewPCMDataPtr)
-			{
-				return;
-			}
+		PCMDataToAppend = ConvertedPCMData.GetData();
+		NumOfSamplesToAppend = ConvertedPCMData.Num();
+	}
+	else
+	{
+		// The audio data is in the sound wave's format again, so any held back frames belong to an earlier part of the stream
+		StreamingResampler.Reset();
+	}
 
-			// Adding new PCM data at the end
-			{
-				FMemory::Memcpy(NewPCMDataPtr, PCMBufferInfo->PCMData.GetView().GetData(), (PCMBufferInfo->PCMData.GetView().Num() * sizeof(float)) - NumOfPreAllocatedByteData);
-				FMemory::Memcpy(reinterpret_cast<uint8*>(NewPCMDataPtr) + ((PCMBufferInfo->PCMData.GetView().Num() * sizeof(float)) - NumOfPreAllocatedByteData), DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData(), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num() * sizeof(float));
-			}
+	return AppendConvertedPCMData_Internal(PCMDataToAppend, NumOfSamplesToAppend, AppendedPCMData);
+}
 
-			PCMBufferInfo->PCMData = FRuntimeBulkDataBuffer<float>(NewPCMDataPtr, NewPCMDataSize);
-			NumOfPreAllocatedByteData = 0;
-		}
+bool UStreamingSoundWave::FlushResampledPCMData_Internal(TArray<float>* AppendedPCMData)
+{
+	if (!StreamingResampler.Flush(ConvertedPCMData))
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to flush the resampled audio data of streaming sound wave"));
+		return false;
+	}
+
+	// The flushed frames are already in the sound wave's format
+	return AppendConvertedPCMData_Internal(ConvertedPCMData.GetData(), ConvertedPCMData.Num(), AppendedPCMData);
+}
 
-		PCMBufferInfo->PCMNumOfFrames += DecodedAudioInfo.PCMInfo.PCMNumOfFrames;
-		Duration += DecodedAudioInfo.SoundWaveBasicInfo.Duration;
-		ResetPlaybackFinish();
+bool UStreamingSoundWave::AppendConvertedPCMData_Internal(const float* PCMData, int64 NumOfSamples, TArray<float>* AppendedPCMData)
+{
+	if (NumOfSamples <= 0)
+	{
+		return true;
 	}
 
+	DetachSharedPCMBuffer_Internal(true);
+
+	// Appending to the spare capacity of the PCM buffer, which grows geometrically, so the whole accumulated PCM data is not copied on every append
+	if (!PCMBufferInfo->PCMData.Append(PCMData, NumOfSamples))
 	{
-		const bool IsBound = [this]()
-		{
-			FRAIScopeLock Lock(&OnPopulateAudioData_DataGuard);
-			return OnPopulateAudioDataNative.IsBound() || OnPopulateAudioData.IsBound();
-		}();
-		if (IsBound)
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate memory to append '%lld' number of PCM data to streaming sound wave"), NumOfSamples);
+		return false;
+	}
+
+	const uint32 NumOfAppendedFrames = static_cast<uint32>(NumOfSamples / NumChannels);
+	PCMBufferInfo->PCMNumOfFrames += NumOfAppendedFrames;
+	Duration += static_cast<float>(NumOfAppendedFrames) / SampleRate;
+	ResetPlaybackFinish();
+
+	AutoReleasePlayedAudioData_Internal();
+
+	if (AppendedPCMData)
+	{
+		AppendedPCMData->Append(PCMData, NumOfSamples);
+	}
+
+	return true;
+}
+
+bool UStreamingSoundWave::IsPopulateAudioDataBound() const
+{
+	FRAIScopeLock Lock(&OnPopulateAudioData_DataGuard);
+	return OnPopulateAudioDataNative.IsBound() || OnPopulateAudioData.IsBound();
+}
+
+void UStreamingSoundWave::BroadcastPopulatedAudioData(TArray<float>&& AppendedPCMData)
+{
+	if (AppendedPCMData.Num() > 0)
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this), PCMData = MoveTemp(AppendedPCMData)]() mutable
 		{
-			TArray<float> PCMData(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData(), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num());
-			AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this), PCMData = MoveTemp(PCMData)]() mutable
+			if (WeakThis.IsValid())
 			{
-				if (WeakThis.IsValid())
+				FRAIScopeLock Lock(&WeakThis->OnPopulateAudioData_DataGuard);
+				if (WeakThis->OnPopulateAudioDataNative.IsBound())
 				{
-					FRAIScopeLock Lock(&WeakThis->OnPopulateAudioData_DataGuard);
-					if (WeakThis->OnPopulateAudioDataNative.IsBound())
-					{
-						WeakThis->OnPopulateAudioDataNative.Broadcast(PCMData);
-					}
-					if (WeakThis->OnPopulateAudioData.IsBound())
-					{
-						WeakThis->OnPopulateAudioData.Broadcast(PCMData);
-					}
+					WeakThis->OnPopulateAudioDataNative.Broadcast(PCMData);
 				}
-				else
+				if (WeakThis->OnPopulateAudioData.IsBound())
 				{
-					UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to broadcast OnPopulateAudioDataNative and OnPopulateAudioData delegates because the streaming sound wave has been destroyed"));
+					WeakThis->OnPopulateAudioData.Broadcast(PCMData);
 				}
-			});
-		}
+			}
+			else
+			{
+				UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to broadcast OnPopulateAudioDataNative and OnPopulateAudioData delegates because the streaming sound wave has been destroyed"));
+			}
+		});
 	}
 
 	{
@@ -169,33 +209,6 @@ void UStreamingSoundWave::PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&&
 			});
 		}
 	}
-
-	AppendAudioTaskQueue.Pop();
-	if (FAudioTaskDelegate* AppendAudioTask = AppendAudioTaskQueue.Peek())
-	{
-		AppendAudioTask->ExecuteIfBound();
-	}
-
-	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully added audio data to streaming sound wave.\nAdded audio info: %s"), *DecodedAudioInfo.ToString());
-}
-
-void UStreamingSoundWave::ReleaseMemory()
-{
-	Super::ReleaseMemory();
-	NumOfPreAllocatedByteData = 0;
-}
-
-void UStreamingSoundWave::ReleasePlayedAudioData(const FOnPlayedAudioDataReleaseResultNative& Result)
-{
-	FRAIScopeLock Lock(&*DataGuard);
-	const int64 NewPCMDataSize = (PCMBufferInfo->PCMNumOfFrames - GetNumOfPlayedFrames_Internal()) * NumChannels;
-
-	if (GetNumOfPlayedFrames_Internal() > 0 && NumOfPreAllocatedByteData > 0 && NewPCMDataSize < PCMBufferInfo->PCMData.GetView().Num())
-	{
-		NumOfPreAllocatedByteData -= (PCMBufferInfo->PCMData.GetView().Num() * sizeof(float)) - (NewPCMDataSize * sizeof(float));
-		NumOfPreAllocatedByteData = NumOfPreAllocatedByteData < 0 ? 0 : NumOfPreAllocatedByteData;
-	}
-	Super::ReleasePlayedAudioData(Result);
 }
 
 UStreamingSoundWave* UStreamingSoundWave::CreateStreamingSoundWave()
@@ -245,26 +258,20 @@ void UStreamingSoundWave::PreAllocateAudioData(int64 NumOfBytesToPreAllocate, co
 		});
 	};
 
-	if (PCMBufferInfo->PCMData.GetView().Num() > 0 || NumOfPreAllocatedByteData > 0)
+	if (PCMBufferInfo->PCMData.GetCapacity() > 0)
 	{
 		ensureMsgf(false, TEXT("Pre-allocation of PCM data can only be applied if the PCM data has not yet been allocated"));
 		ExecuteResult(false);
 		return;
 	}
 
-	float* NewPCMDataPtr = static_cast<float*>(FMemory::Malloc(NumOfBytesToPreAllocate));
-	if (!NewPCMDataPtr)
+	if (!PCMBufferInfo->PCMData.Reserve(NumOfBytesToPreAllocate / sizeof(float)))
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to allocate memory to pre-allocate streaming sound wave audio data with '%lld' number of bytes"), NumOfBytesToPreAllocate);
 		ExecuteResult(false);
 		return;
 	}
 
-	{
-		NumOfPreAllocatedByteData = NumOfBytesToPreAllocate;
-		PCMBufferInfo->PCMData = FRuntimeBulkDataBuffer<float>(NewPCMDataPtr, NumOfBytesToPreAllocate / sizeof(float));
-	}
-
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Successfully pre-allocated '%lld' number of bytes"), NumOfBytesToPreAllocate);
 	ExecuteResult(true);
 }
@@ -331,7 +338,8 @@ void UStreamingSoundWave::AppendAudioDataFromRAW(TArray<uint8> RAWData, ERuntime
 	uint8* ByteDataPtr = RAWData.GetData();
 	const int64 ByteDataSize = RAWData.Num();
 
-	float* Float32DataPtr = nullptr;
+	// The float data is only needed until appended, so it is kept in a scratch buffer
+	TRuntimeAudioScratchBuffer<float> Float32Data;
 	int64 NumOfSamples = 0;
 
 	// Transcoding RAW data to 32-bit float data
@@ -341,49 +349,53 @@ void UStreamingSoundWave::AppendAudioDataFromRAW(TArray<uint8> RAWData, ERuntime
 		case ERuntimeRAWAudioFormat::Int8:
 			{
 				NumOfSamples = ByteDataSize / sizeof(int8);
-				FRAW_RuntimeCodec::TranscodeRAWData<int8, float>(reinterpret_cast<int8*>(ByteDataPtr), NumOfSamples, Float32DataPtr);
+				FRAW_RuntimeCodec::TranscodeRAWData<int8, float>(reinterpret_cast<int8*>(ByteDataPtr), NumOfSamples, Float32Data);
 				break;
 			}
 		case ERuntimeRAWAudioFormat::UInt8:
 			{
 				NumOfSamples = ByteDataSize / sizeof(uint8);
-				FRAW_RuntimeCodec::TranscodeRAWData<uint8, float>(ByteDataPtr, NumOfSamples, Float32DataPtr);
+				FRAW_RuntimeCodec::TranscodeRAWData<uint8, float>(ByteDataPtr, NumOfSamples, Float32Data);
 				break;
 			}
 		case ERuntimeRAWAudioFormat::Int16:
 			{
 				NumOfSamples = ByteDataSize / sizeof(int16);
-				FRAW_RuntimeCodec::TranscodeRAWData<int16, float>(reinterpret_cast<int16*>(ByteDataPtr), NumOfSamples, Float32DataPtr);
+				FRAW_RuntimeCodec::TranscodeRAWData<int16, float>(reinterpret_cast<int16*>(ByteDataPtr), NumOfSamples, Float32Data);
 				break;
 			}
 		case ERuntimeRAWAudioFormat::UInt16:
 			{
 				NumOfSamples = ByteDataSize / sizeof(uint16);
-				FRAW_RuntimeCodec::TranscodeRAWData<uint16, float>(reinterpret_cast<uint16*>(ByteDataPtr), NumOfSamples, Float32DataPtr);
+				FRAW_RuntimeCodec::TranscodeRAWData<uint16, float>(reinterpret_cast<uint16*>(ByteDataPtr), NumOfSamples, Float32Data);
 				break;
 			}
 		case ERuntimeRAWAudioFormat::UInt32:
 			{
 				NumOfSamples = ByteDataSize / sizeof(uint32);
-				FRAW_RuntimeCodec::TranscodeRAWData<uint32, float>(reinterpret_cast<uint32*>(ByteDataPtr), NumOfSamples, Float32DataPtr);
+				FRAW_RuntimeCodec::TranscodeRAWData<uint32, float>(reinterpret_cast<uint32*>(ByteDataPtr), NumOfSamples, Float32Data);
 				break;
 			}
 		case ERuntimeRAWAudioFormat::Int32:
 			{
 				NumOfSamples = ByteDataSize / sizeof(int32);
-				FRAW_RuntimeCodec::TranscodeRAWData<int32, float>(reinterpret_cast<int32*>(ByteDataPtr), NumOfSamples, Float32DataPtr);
+				FRAW_RuntimeCodec::TranscodeRAWData<int32, float>(reinterpret_cast<int32*>(ByteDataPtr), NumOfSamples, Float32Data);
 				break;
 			}
 		case ERuntimeRAWAudioFormat::Float32:
 			{
 				NumOfSamples = ByteDataSize / sizeof(float);
-				Float32DataPtr = static_cast<float*>(FMemory::Memcpy(FMemory::Malloc(ByteDataSize), ByteDataPtr, ByteDataSize));
+				Float32Data = TRuntimeAudioScratchBuffer<float>(NumOfSamples);
+				if (Float32Data.IsValid())
+				{
+					FMemory::Memcpy(Float32Data.GetData(), ByteDataPtr, NumOfSamples * sizeof(float));
+				}
 				break;
 			}
 		}
 	}
 
-	if (!Float32DataPtr || NumOfSamples <= 0)
+	if (!Float32Data.IsValid() || NumOfSamples <= 0)
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to transcode RAW data to decoded audio info"))
 		return;
@@ -393,7 +405,7 @@ void UStreamingSoundWave::AppendAudioDataFromRAW(TArray<uint8> RAWData, ERuntime
 	{
 		FPCMStruct PCMInfo;
 		{
-			PCMInfo.PCMData = FRuntimeBulkDataBuffer<float>(Float32DataPtr, NumOfSamples);
+			PCMInfo.PCMData = Float32Data.ToBulkDataBuffer();
 			PCMInfo.PCMNumOfFrames = NumOfSamples / NumOfChannels;
 		}
 		DecodedAudioInfo.PCMInfo = MoveTemp(PCMInfo);
@@ -426,3 +438,47 @@ void UStreamingSoundWave::SetStopSoundOnPlaybackFinish(bool bStop)
 {
 	bStopSoundOnPlaybackFinish = bStop;
 }
+
+void UStreamingSoundWave::SetResamplingQuality(ERuntimeResamplingQuality Quality)
+{
+	FRAIScopeLock Lock(&*DataGuard);
+	ResamplingQuality = Quality;
+}
+
+void UStreamingSoundWave::FinishAppendingAudioData()
+{
+	if (IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [WeakThis = MakeWeakObjectPtr(this)]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->FinishAppendingAudioData();
+			}
+			else
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Failed to finish appending audio data to streaming sound wave as the streaming sound wave has been destroyed"));
+			}
+		});
+		return;
+	}
+
+	const bool bCopyAppendedPCMData = IsPopulateAudioDataBound();
+	TArray<float> AppendedPCMData;
+	{
+		// Flushing and appending under the same lock, otherwise the render callback could take DataGuard in between and run out of frames
+		// while the held back ones are neither in the resampler nor in the PCM buffer
+		FRAIScopeLock Lock(&*DataGuard);
+		if (!StreamingResampler.IsResampling())
+		{
+			return;
+		}
+
+		if (!FlushResampledPCMData_Internal(bCopyAppendedPCMData ? &AppendedPCMData : nullptr))
+		{
+			return;
+		}
+	}
+
+	BroadcastPopulatedAudioData(MoveTemp(AppendedPCMData));
+}
@@ -4,6 +4,175 @@
 
 #include "CoreMinimal.h"
 #include "RuntimeAudioImporterTypes.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+/**
+ * Base runtime stream decoder. Decodes audio data incrementally, pulling the encoded data from a file handle in fixed-size chunks
+ * Unlike codecs, stream decoders are stateful and are created per decoded file
+ */
+class RUNTIMEAUDIOIMPORTER_API FBaseRuntimeStreamDecoder
+{
+public:
+	explicit FBaseRuntimeStreamDecoder(TUniquePtr<IFileHandle>&& InFileHandle, int64 InReadChunkSize = 64 * 1024)
+		: FileHandle(MoveTemp(InFileHandle))
+		, FileSize(FileHandle.IsValid() ? FileHandle->Size() : 0)
+		, ReadChunkSize(FMath::Max<int64>(InReadChunkSize, 1))
+		, ReadChunkOffset(0)
+		, ReadChunkCursor(0)
+	{
+		ReadChunk.Reserve(ReadChunkSize);
+	}
+
+	virtual ~FBaseRuntimeStreamDecoder() = default;
+
+	/**
+	 * Decode the next frames of the stream
+	 *
+	 * @param NumOfFrames Maximum number of frames to decode
+	 * @param OutPCMData Interleaved 32-bit float PCM data with room for NumOfFrames * GetNumOfChannels() samples
+	 * @return The number of decoded frames, or 0 if the end of the stream has been reached
+	 */
+	virtual int64 DecodeFrames(int64 NumOfFrames, float* OutPCMData)
+	{
+		ensureMsgf(false, TEXT("DecodeFrames cannot be called from base runtime stream decoder"));
+		return 0;
+	}
+
+	/**
+	 * Retrieve the number of samples per second of the decoded audio data
+	 */
+	virtual uint32 GetSampleRate() const
+	{
+		ensureMsgf(false, TEXT("GetSampleRate cannot be called from base runtime stream decoder"));
+		return 0;
+	}
+
+	/**
+	 * Retrieve the number of channels of the decoded audio data
+	 */
+	virtual uint32 GetNumOfChannels() const
+	{
+		ensureMsgf(false, TEXT("GetNumOfChannels cannot be called from base runtime stream decoder"));
+		return 0;
+	}
+
+	/**
+	 * Retrieve the total number of frames in the stream, or 0 if it cannot be known without decoding the whole stream
+	 */
+	virtual int64 GetNumOfFrames() const
+	{
+		return 0;
+	}
+
+	/**
+	 * Retrieve the size of the encoded audio file, in bytes
+	 */
+	int64 GetFileSize() const
+	{
+		return FileSize;
+	}
+
+	/**
+	 * Retrieve the position up to which the encoded audio file has been consumed, in bytes
+	 */
+	int64 GetFilePosition() const
+	{
+		return ReadChunkOffset + ReadChunkCursor;
+	}
+
+protected:
+	/**
+	 * Read encoded audio data, refilling the read chunk from the file whenever it runs out. Meant to back the read callbacks of the decoders
+	 *
+	 * @param OutData Memory to read the data into
+	 * @param NumOfBytes Number of bytes to read
+	 * @return The number of bytes actually read, less than NumOfBytes at the end of the file
+	 */
+	int64 Read(void* OutData, int64 NumOfBytes)
+	{
+		uint8* OutBytes = static_cast<uint8*>(OutData);
+		int64 NumOfBytesRead = 0;
+
+		while (NumOfBytesRead < NumOfBytes)
+		{
+			if (ReadChunkCursor >= ReadChunk.Num())
+			{
+				const int64 NewReadChunkOffset = ReadChunkOffset + ReadChunk.Num();
+				const int64 NewReadChunkSize = FMath::Min(ReadChunkSize, FileSize - NewReadChunkOffset);
+				if (NewReadChunkSize <= 0)
+				{
+					break;
+				}
+
+				ReadChunk.SetNumUninitialized(NewReadChunkSize);
+				if ((FileHandle->Tell() != NewReadChunkOffset && !FileHandle->Seek(NewReadChunkOffset)) || !FileHandle->Read(ReadChunk.GetData(), NewReadChunkSize))
+				{
+					ReadChunkOffset = NewReadChunkOffset;
+					ReadChunkCursor = 0;
+					ReadChunk.Reset();
+					break;
+				}
+
+				ReadChunkOffset = NewReadChunkOffset;
+				ReadChunkCursor = 0;
+			}
+
+			const int64 NumOfBytesToCopy = FMath::Min(NumOfBytes - NumOfBytesRead, ReadChunk.Num() - ReadChunkCursor);
+			FMemory::Memcpy(OutBytes + NumOfBytesRead, ReadChunk.GetData() + ReadChunkCursor, NumOfBytesToCopy);
+			ReadChunkCursor += NumOfBytesToCopy;
+			NumOfBytesRead += NumOfBytesToCopy;
+		}
+
+		return NumOfBytesRead;
+	}
+
+	/**
+	 * Move the read position within the encoded audio data. Meant to back the seek callbacks of the decoders
+	 *
+	 * @param Offset Offset to move to, in bytes
+	 * @param bRelative Whether the offset is relative to the current read position or to the beginning of the file
+	 * @return True if the position is within the file
+	 */
+	bool Seek(int64 Offset, bool bRelative)
+	{
+		const int64 NewPosition = bRelative ? GetFilePosition() + Offset : Offset;
+		if (NewPosition < 0 || NewPosition > FileSize)
+		{
+			return false;
+		}
+
+		// Staying within the current read chunk avoids re-reading it from the file
+		if (NewPosition >= ReadChunkOffset && NewPosition <= ReadChunkOffset + ReadChunk.Num())
+		{
+			ReadChunkCursor = NewPosition - ReadChunkOffset;
+			return true;
+		}
+
+		ReadChunkOffset = NewPosition;
+		ReadChunkCursor = 0;
+		ReadChunk.Reset();
+		return true;
+	}
+
+private:
+	/** Handle of the file containing the encoded audio data */
+	TUniquePtr<IFileHandle> FileHandle;
+
+	/** Size of the file containing the encoded audio data, in bytes */
+	int64 FileSize;
+
+	/** Maximum number of bytes read from the file at once */
+	int64 ReadChunkSize;
+
+	/** Chunk of encoded audio data most recently read from the file */
+	TArray64<uint8> ReadChunk;
+
+	/** Position of the read chunk within the file */
+	int64 ReadChunkOffset;
+
+	/** Read position within the read chunk */
+	int64 ReadChunkCursor;
+};
 
 // TODO: Make FBaseRuntimeCodec an abstract class (currently not possible due to TUniquePtr requiring a non-abstract base class)
 
@@ -34,6 +203,30 @@ public:
 		return false;
 	}
 
+	/**
+	 * Retrieve audio header information from a file, reading only the parts of the file needed for it rather than the whole file
+	 * By default, the header information is taken from a stream decoder, which is enough for formats whose headers store the total number of frames
+	 *
+	 * @param FileHandle Handle of the file containing the encoded audio data
+	 * @param HeaderInfo Retrieved header information
+	 * @return False if the codec cannot retrieve the header information without reading the whole file, or the audio data is invalid
+	 */
+	virtual bool GetHeaderInfoFromFile(TUniquePtr<IFileHandle>&& FileHandle, FRuntimeAudioHeaderInfo& HeaderInfo)
+	{
+		TUniquePtr<FBaseRuntimeStreamDecoder> StreamDecoder = CreateStreamDecoder(MoveTemp(FileHandle));
+		if (!StreamDecoder.IsValid() || StreamDecoder->GetNumOfFrames() <= 0 || StreamDecoder->GetSampleRate() == 0 || StreamDecoder->GetNumOfChannels() == 0)
+		{
+			return false;
+		}
+
+		HeaderInfo.Duration = static_cast<float>(StreamDecoder->GetNumOfFrames()) / StreamDecoder->GetSampleRate();
+		HeaderInfo.NumOfChannels = StreamDecoder->GetNumOfChannels();
+		HeaderInfo.SampleRate = StreamDecoder->GetSampleRate();
+		HeaderInfo.PCMDataSize = StreamDecoder->GetNumOfFrames() * StreamDecoder->GetNumOfChannels();
+		HeaderInfo.AudioFormat = GetAudioFormat();
+		return true;
+	}
+
 	/**
 	 * Encode uncompressed PCM data into a compressed format
 	 */
@@ -52,6 +245,17 @@ public:
 		return false;
 	}
 
+	/**
+	 * Create a decoder that decodes audio data incrementally from a file, without loading the whole file into memory
+	 *
+	 * @param FileHandle Handle of the file containing the encoded audio data
+	 * @return The stream decoder, or a nullptr if the codec does not support incremental decoding or the audio data is invalid
+	 */
+	virtual TUniquePtr<FBaseRuntimeStreamDecoder> CreateStreamDecoder(TUniquePtr<IFileHandle>&& FileHandle)
+	{
+		return nullptr;
+	}
+
 	/**
 	 * Retrieve the format applicable to this codec
 	 */
@@ -60,4 +264,26 @@ public:
 		ensureMsgf(false, TEXT("GetAudioFormat cannot be called from base runtime codec"));
 		return ERuntimeAudioFormat::Invalid;
 	}
+
+protected:
+	/**
+	 * Read a range of a file, clamped to the size of the file
+	 *
+	 * @param FileHandle Handle of the file to read from
+	 * @param Offset Position of the range within the file, in bytes
+	 * @param NumOfBytes Maximum size of the range, in bytes
+	 * @param OutData Read data
+	 * @return True if the range was read successfully
+	 */
+	static bool ReadFileRange(IFileHandle& FileHandle, int64 Offset, int64 NumOfBytes, TArray64<uint8>& OutData)
+	{
+		const int64 NumOfBytesToRead = FMath::Min(NumOfBytes, FileHandle.Size() - Offset);
+		if (Offset < 0 || NumOfBytesToRead <= 0)
+		{
+			return false;
+		}
+
+		OutData.SetNumUninitialized(NumOfBytesToRead);
+		return FileHandle.Seek(Offset) && FileHandle.Read(OutData.GetData(), NumOfBytesToRead);
+	}
 };
@@ -11,8 +11,10 @@ public:
 	//~ Begin FBaseRuntimeCodec Interface
 	virtual bool CheckAudioFormat(const FRuntimeBulkDataBuffer<uint8>& AudioData) override;
 	virtual bool GetHeaderInfo(FEncodedAudioStruct EncodedData, FRuntimeAudioHeaderInfo& HeaderInfo) override;
+	virtual bool GetHeaderInfoFromFile(TUniquePtr<IFileHandle>&& FileHandle, FRuntimeAudioHeaderInfo& HeaderInfo) override;
 	virtual bool Encode(FDecodedAudioStruct DecodedData, FEncodedAudioStruct& EncodedData, uint8 Quality) override;
 	virtual bool Decode(FEncodedAudioStruct EncodedData, FDecodedAudioStruct& DecodedData) override;
+	virtual TUniquePtr<FBaseRuntimeStreamDecoder> CreateStreamDecoder(TUniquePtr<IFileHandle>&& FileHandle) override;
 	virtual ERuntimeAudioFormat GetAudioFormat() const override { return ERuntimeAudioFormat::Mp3; }
 	//~ End FBaseRuntimeCodec Interface
 };
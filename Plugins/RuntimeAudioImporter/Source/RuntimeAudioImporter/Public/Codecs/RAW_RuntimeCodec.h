@@ -5,7 +5,10 @@
 #include "CoreMinimal.h"
 #include "Math/UnrealMathUtility.h"
 #include "HAL/UnrealMemory.h"
+#include "Math/VectorRegister.h"
 #include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+#include "RuntimeAudioScratchPool.h"
 #include "SampleBuffer.h"
 #include "AudioResampler.h"
 #include <type_traits>
@@ -80,11 +83,8 @@ public:
 		const IntegralTypeFrom* DataFrom = reinterpret_cast<const IntegralTypeFrom*>(RAWData_From.GetData());
 		const int64 RawDataSize = RAWData_From.Num() / sizeof(IntegralTypeFrom);
 
-		IntegralTypeTo* DataTo = nullptr;
-		TranscodeRAWData<IntegralTypeFrom, IntegralTypeTo>(DataFrom, RawDataSize, DataTo);
-
-		RAWData_To = TArray64<uint8>(reinterpret_cast<uint8*>(DataTo), RawDataSize * sizeof(IntegralTypeTo));
-		FMemory::Free(DataTo);
+		RAWData_To.SetNumUninitialized(RawDataSize * sizeof(IntegralTypeTo));
+		TranscodeRAWDataIntoBuffer<IntegralTypeFrom, IntegralTypeTo>(DataFrom, RawDataSize, reinterpret_cast<IntegralTypeTo*>(RAWData_To.GetData()));
 	}
 
 	/**
@@ -100,17 +100,163 @@ public:
 		/** Creating an empty PCM buffer */
 		RAWDataTo = static_cast<IntegralTypeTo*>(FMemory::Malloc(NumOfSamples * sizeof(IntegralTypeTo)));
 
+		TranscodeRAWDataIntoBuffer<IntegralTypeFrom, IntegralTypeTo>(RAWDataFrom, NumOfSamples, RAWDataTo);
+	}
+
+	/**
+	 * Transcoding one RAW Data format to another into a scratch buffer from the scratch buffer pool. Suitable for intermediate data
+	 *
+	 * @param RAWDataFrom Pointer to memory location of the RAW data for transcoding
+	 * @param NumOfSamples Number of samples in the RAW data
+	 * @param RAWDataTo Scratch buffer with the transcoded RAW data. Not valid if the allocation failed
+	 */
+	template <typename IntegralTypeFrom, typename IntegralTypeTo>
+	static void TranscodeRAWData(const IntegralTypeFrom* RAWDataFrom, int64 NumOfSamples, TRuntimeAudioScratchBuffer<IntegralTypeTo>& RAWDataTo)
+	{
+		RAWDataTo = TRuntimeAudioScratchBuffer<IntegralTypeTo>(NumOfSamples);
+		if (RAWDataTo.IsValid())
+		{
+			TranscodeRAWDataIntoBuffer<IntegralTypeFrom, IntegralTypeTo>(RAWDataFrom, NumOfSamples, RAWDataTo.GetData());
+		}
+	}
+
+	/**
+	 * Transcoding one RAW Data format to another into a caller-provided buffer, without allocating
+	 *
+	 * @param RAWDataFrom Pointer to memory location of the RAW data for transcoding
+	 * @param NumOfSamples Number of samples in the RAW data
+	 * @param RAWDataTo Pointer to memory location with room for NumOfSamples transcoded samples
+	 * @note RAWDataTo may point to RAWDataFrom (in-place transcoding) as long as the destination format is not wider than the source format
+	 */
+	template <typename IntegralTypeFrom, typename IntegralTypeTo>
+	static void TranscodeRAWDataIntoBuffer(const IntegralTypeFrom* RAWDataFrom, int64 NumOfSamples, IntegralTypeTo* RAWDataTo)
+	{
 		const TTuple<long long, long long> MinAndMaxValuesFrom{GetRawMinAndMaxValues<IntegralTypeFrom>()};
 		const TTuple<long long, long long> MinAndMaxValuesTo{GetRawMinAndMaxValues<IntegralTypeTo>()};
 
-		/** Iterating through the RAW Data to transcode values using a divisor */
-		for (int64 SampleIndex = 0; SampleIndex < NumOfSamples; ++SampleIndex)
+		/** Same mapping as FMath::GetMappedRangeValueClamped, reduced to a single multiply-add followed by a clamp */
+		const double Scale = static_cast<double>(MinAndMaxValuesTo.Value - MinAndMaxValuesTo.Key) / static_cast<double>(MinAndMaxValuesFrom.Value - MinAndMaxValuesFrom.Key);
+		const double Offset = static_cast<double>(MinAndMaxValuesTo.Key) - static_cast<double>(MinAndMaxValuesFrom.Key) * Scale;
+		const double MinValueTo = static_cast<double>(MinAndMaxValuesTo.Key);
+		const double MaxValueTo = static_cast<double>(MinAndMaxValuesTo.Value);
+
+		int64 SampleIndex = 0;
+
+		/**
+		 * Vectorized path, loading four to sixteen samples at a time depending on the source format. 32-bit integer destinations stay on the scalar path since their range cannot be represented exactly in single precision
+		 * Every block is fully loaded before it is stored, which keeps in-place transcoding to a narrower format safe
+		 */
+		if constexpr (sizeof(IntegralTypeTo) < 4 || std::is_same<IntegralTypeTo, float>::value)
+		{
+			const VectorRegister4Float ScaleVector = VectorSetFloat1(static_cast<float>(Scale));
+			const VectorRegister4Float OffsetVector = VectorSetFloat1(static_cast<float>(Offset));
+			const VectorRegister4Float MinVector = VectorSetFloat1(static_cast<float>(MinValueTo));
+			const VectorRegister4Float MaxVector = VectorSetFloat1(static_cast<float>(MaxValueTo));
+
+			/** Maps four samples to the destination range and stores them */
+			auto MapAndStoreSamples = [&ScaleVector, &MinVector, &MaxVector](VectorRegister4Float Samples, const VectorRegister4Float& SamplesOffsetVector, IntegralTypeTo* Destination)
+			{
+				Samples = VectorMin(VectorMax(VectorMultiplyAdd(Samples, ScaleVector, SamplesOffsetVector), MinVector), MaxVector);
+
+				if constexpr (std::is_same<IntegralTypeTo, float>::value)
+				{
+					VectorStore(Samples, Destination);
+				}
+				else
+				{
+					alignas(16) int32 TruncatedSamples[4];
+					VectorIntStore(VectorFloatToInt(Samples), TruncatedSamples);
+
+					Destination[0] = static_cast<IntegralTypeTo>(TruncatedSamples[0]);
+					Destination[1] = static_cast<IntegralTypeTo>(TruncatedSamples[1]);
+					Destination[2] = static_cast<IntegralTypeTo>(TruncatedSamples[2]);
+					Destination[3] = static_cast<IntegralTypeTo>(TruncatedSamples[3]);
+				}
+			};
+
+			constexpr bool bSignedFrom = std::is_signed<IntegralTypeFrom>::value;
+
+			if constexpr (std::is_same<IntegralTypeFrom, float>::value)
+			{
+				for (; SampleIndex + 4 <= NumOfSamples; SampleIndex += 4)
+				{
+					MapAndStoreSamples(VectorLoad(RAWDataFrom + SampleIndex), OffsetVector, RAWDataTo + SampleIndex);
+				}
+			}
+			else if constexpr (sizeof(IntegralTypeFrom) == 4)
+			{
+				/**
+				 * 32-bit integers are converted directly. Unsigned ones are biased into the signed range first (by flipping the sign bit),
+				 * and the bias is compensated in the offset of the mapping
+				 */
+				const VectorRegister4Int SignBitVector = VectorIntSet1(bSignedFrom ? 0 : TNumericLimits<int32>::Min());
+				const VectorRegister4Float SamplesOffsetVector = VectorSetFloat1(static_cast<float>(bSignedFrom ? Offset : Offset + 2147483648.0 * Scale));
+
+				for (; SampleIndex + 4 <= NumOfSamples; SampleIndex += 4)
+				{
+					MapAndStoreSamples(VectorIntToFloat(VectorIntXor(VectorIntLoad(RAWDataFrom + SampleIndex), SignBitVector)), SamplesOffsetVector, RAWDataTo + SampleIndex);
+				}
+			}
+			else if constexpr (sizeof(IntegralTypeFrom) == 2)
+			{
+				/** Eight 16-bit samples are loaded at once and widened to 32 bits by shifting the lower and upper halves of each lane into place */
+				for (; SampleIndex + 8 <= NumOfSamples; SampleIndex += 8)
+				{
+					const VectorRegister4Int PackedSamples = VectorIntLoad(RAWDataFrom + SampleIndex);
+					const VectorRegister4Float EvenSamples = ExtractLaneSamples<bSignedFrom, 0, 16>(PackedSamples);
+					const VectorRegister4Float OddSamples = ExtractLaneSamples<bSignedFrom, 16, 16>(PackedSamples);
+
+					MapAndStoreSamples(VectorSwizzle(VectorShuffle(EvenSamples, OddSamples, 0, 1, 0, 1), 0, 2, 1, 3), OffsetVector, RAWDataTo + SampleIndex);
+					MapAndStoreSamples(VectorSwizzle(VectorShuffle(EvenSamples, OddSamples, 2, 3, 2, 3), 0, 2, 1, 3), OffsetVector, RAWDataTo + SampleIndex + 4);
+				}
+			}
+			else if constexpr (sizeof(IntegralTypeFrom) == 1)
+			{
+				/** Sixteen 8-bit samples are loaded at once, widened to 32 bits by shifting each byte of the lanes into place, and transposed back into their order */
+				for (; SampleIndex + 16 <= NumOfSamples; SampleIndex += 16)
+				{
+					const VectorRegister4Int PackedSamples = VectorIntLoad(RAWDataFrom + SampleIndex);
+					const VectorRegister4Float Samples0 = ExtractLaneSamples<bSignedFrom, 0, 8>(PackedSamples);
+					const VectorRegister4Float Samples1 = ExtractLaneSamples<bSignedFrom, 8, 8>(PackedSamples);
+					const VectorRegister4Float Samples2 = ExtractLaneSamples<bSignedFrom, 16, 8>(PackedSamples);
+					const VectorRegister4Float Samples3 = ExtractLaneSamples<bSignedFrom, 24, 8>(PackedSamples);
+
+					const VectorRegister4Float LowSamples01 = VectorShuffle(Samples0, Samples1, 0, 1, 0, 1);
+					const VectorRegister4Float LowSamples23 = VectorShuffle(Samples2, Samples3, 0, 1, 0, 1);
+					const VectorRegister4Float HighSamples01 = VectorShuffle(Samples0, Samples1, 2, 3, 2, 3);
+					const VectorRegister4Float HighSamples23 = VectorShuffle(Samples2, Samples3, 2, 3, 2, 3);
+
+					MapAndStoreSamples(VectorShuffle(LowSamples01, LowSamples23, 0, 2, 0, 2), OffsetVector, RAWDataTo + SampleIndex);
+					MapAndStoreSamples(VectorShuffle(LowSamples01, LowSamples23, 1, 3, 1, 3), OffsetVector, RAWDataTo + SampleIndex + 4);
+					MapAndStoreSamples(VectorShuffle(HighSamples01, HighSamples23, 0, 2, 0, 2), OffsetVector, RAWDataTo + SampleIndex + 8);
+					MapAndStoreSamples(VectorShuffle(HighSamples01, HighSamples23, 1, 3, 1, 3), OffsetVector, RAWDataTo + SampleIndex + 12);
+				}
+			}
+		}
+
+		/** Scalar path for the remaining samples */
+		for (; SampleIndex < NumOfSamples; ++SampleIndex)
 		{
-			RAWDataTo[SampleIndex] = static_cast<IntegralTypeTo>(FMath::GetMappedRangeValueClamped(FVector2D(MinAndMaxValuesFrom.Key, MinAndMaxValuesFrom.Value), FVector2D(MinAndMaxValuesTo.Key, MinAndMaxValuesTo.Value), RAWDataFrom[SampleIndex]));
+			const double MappedValue = static_cast<double>(RAWDataFrom[SampleIndex]) * Scale + Offset;
+			RAWDataTo[SampleIndex] = static_cast<IntegralTypeTo>(FMath::Clamp(MappedValue, MinValueTo, MaxValueTo));
 		}
+	}
 
-		UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Transcoding RAW data of size '%llu' (min: %lld, max: %lld) to size '%llu' (min: %lld, max: %lld)"),
-		       static_cast<uint64>(sizeof(IntegralTypeFrom)), MinAndMaxValuesFrom.Key, MinAndMaxValuesFrom.Value, static_cast<uint64>(sizeof(IntegralTypeTo)), MinAndMaxValuesTo.Key, MinAndMaxValuesTo.Value);
+	/**
+	 * Getting the engine resampling method matching the specified resampling quality
+	 */
+	static Audio::EResamplingMethod GetResamplingMethod(ERuntimeResamplingQuality Quality)
+	{
+		switch (Quality)
+		{
+		case ERuntimeResamplingQuality::Linear:
+			return Audio::EResamplingMethod::Linear;
+		case ERuntimeResamplingQuality::SincFast:
+			return Audio::EResamplingMethod::FastSinc;
+		case ERuntimeResamplingQuality::BestSinc:
+		default:
+			return Audio::EResamplingMethod::BestSinc;
+		}
 	}
 
 	/**
@@ -121,9 +267,10 @@ public:
 	 * @param SourceSampleRate Source sample rate of the RAW data
 	 * @param DestinationSampleRate Destination sample rate of the RAW data
 	 * @param ResampledRAWData Resampled RAW data
+	 * @param Quality Resampling quality
 	 * @return True if the RAW data was successfully resampled
 	 */
-	static bool ResampleRAWData(Audio::FAlignedFloatBuffer& RAWData, int32 NumOfChannels, int32 SourceSampleRate, int32 DestinationSampleRate, Audio::FAlignedFloatBuffer& ResampledRAWData)
+	static bool ResampleRAWData(Audio::FAlignedFloatBuffer& RAWData, int32 NumOfChannels, int32 SourceSampleRate, int32 DestinationSampleRate, Audio::FAlignedFloatBuffer& ResampledRAWData, ERuntimeResamplingQuality Quality = ERuntimeResamplingQuality::BestSinc)
 	{
 		if (NumOfChannels <= 0)
 		{
@@ -149,7 +296,7 @@ public:
 		}
 
 		const Audio::FResamplingParameters ResampleParameters = {
-			Audio::EResamplingMethod::BestSinc,
+			GetResamplingMethod(Quality),
 			NumOfChannels,
 			static_cast<float>(SourceSampleRate),
 			static_cast<float>(DestinationSampleRate),
@@ -211,4 +358,232 @@ public:
 		RemixedRAWData = Audio::FAlignedFloatBuffer(PCMSampleBuffer.GetData(), PCMSampleBuffer.GetNumSamples());
 		return true;
 	}
+
+private:
+	/**
+	 * Extract the bits [BitOffset, BitOffset + BitWidth) of each 32-bit lane as a sign- or zero-extended integer and convert them to float
+	 * Used to widen packed 8-bit and 16-bit samples without loading them one by one
+	 */
+	template <bool bSigned, int32 BitOffset, int32 BitWidth>
+	static FORCEINLINE VectorRegister4Float ExtractLaneSamples(const VectorRegister4Int& PackedSamples)
+	{
+		constexpr int32 LeftShift = 32 - BitOffset - BitWidth;
+		VectorRegister4Int Samples = PackedSamples;
+		if constexpr (LeftShift > 0)
+		{
+			Samples = VectorShiftLeftImm(Samples, LeftShift);
+		}
+
+		if constexpr (bSigned)
+		{
+			return VectorIntToFloat(VectorShiftRightImmArithmetic(Samples, 32 - BitWidth));
+		}
+		else
+		{
+			return VectorIntToFloat(VectorShiftRightImmLogical(Samples, 32 - BitWidth));
+		}
+	}
+};
+
+/**
+ * Resampler and channel mixer for consecutive chunks of interleaved PCM data forming one continuous stream
+ * Unlike ResampleRAWData, the resampler state (filter history and fractional read position) is carried across chunks,
+ * so the filter is set up only once and there are no discontinuities at chunk boundaries
+ * Not thread-safe, the chunks must be processed sequentially
+ */
+class FRuntimeStreamingResampler
+{
+public:
+	FRuntimeStreamingResampler()
+		: SourceSampleRate(0)
+		, DestinationSampleRate(0)
+		, NumOfResampledChannels(0)
+		, Quality(ERuntimeResamplingQuality::BestSinc)
+		, NumOfSourceChannels(0)
+		, NumOfDestinationChannels(0)
+	{
+	}
+
+	/**
+	 * Convert the next chunk of the stream to the destination sample rate and number of channels
+	 * The resampler state is reset if the source format or the quality differs from the previous chunk
+	 * Once warmed up, no memory is allocated as long as the format stays the same
+	 *
+	 * @param PCMData Interleaved PCM data of the chunk in the source format. May be nullptr if NumOfSamples is zero, e.g. to only flush the stream
+	 * @param NumOfSamples Number of samples in PCMData
+	 * @param InSourceSampleRate Source sample rate
+	 * @param SourceNumOfChannels Source number of channels
+	 * @param InDestinationSampleRate Destination sample rate
+	 * @param DestinationNumOfChannels Destination number of channels
+	 * @param InQuality Resampling quality
+	 * @param ConvertedPCMData Interleaved PCM data in the destination format. Some frames may be held back by the resampler until the next chunk. Its allocation is reused
+	 * @param bEndOfStream Whether this is the last chunk of the stream, in which case the frames held back by the resampler are output as well
+	 * @return True if the chunk was successfully converted
+	 */
+	bool ProcessChunk(const float* PCMData, int64 NumOfSamples, int32 InSourceSampleRate, int32 SourceNumOfChannels, int32 InDestinationSampleRate, int32 DestinationNumOfChannels, ERuntimeResamplingQuality InQuality, Audio::FAlignedFloatBuffer& ConvertedPCMData, bool bEndOfStream = false)
+	{
+		if (InSourceSampleRate <= 0 || InDestinationSampleRate <= 0 || SourceNumOfChannels <= 0 || DestinationNumOfChannels <= 0)
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to convert streamed audio data from sample rate %d and %d channels to sample rate %d and %d channels because the format is invalid"), InSourceSampleRate, SourceNumOfChannels, InDestinationSampleRate, DestinationNumOfChannels);
+			return false;
+		}
+
+		const int32 NumOfFrames = static_cast<int32>(NumOfSamples / SourceNumOfChannels);
+
+		if (InSourceSampleRate == InDestinationSampleRate)
+		{
+			Reset();
+			return MixChannels(PCMData, NumOfFrames, SourceNumOfChannels, DestinationNumOfChannels, ConvertedPCMData);
+		}
+
+		NumOfSourceChannels = SourceNumOfChannels;
+		NumOfDestinationChannels = DestinationNumOfChannels;
+
+		if (SourceNumOfChannels == DestinationNumOfChannels)
+		{
+			return Resample(PCMData, NumOfFrames, InSourceSampleRate, InDestinationSampleRate, SourceNumOfChannels, InQuality, ConvertedPCMData, bEndOfStream);
+		}
+
+		// Mixing down before resampling and mixing up after it, so that the least number of channels is resampled
+		if (DestinationNumOfChannels < SourceNumOfChannels)
+		{
+			return MixChannels(PCMData, NumOfFrames, SourceNumOfChannels, DestinationNumOfChannels, IntermediatePCMData)
+				&& Resample(IntermediatePCMData.GetData(), NumOfFrames, InSourceSampleRate, InDestinationSampleRate, DestinationNumOfChannels, InQuality, ConvertedPCMData, bEndOfStream);
+		}
+
+		return Resample(PCMData, NumOfFrames, InSourceSampleRate, InDestinationSampleRate, SourceNumOfChannels, InQuality, IntermediatePCMData, bEndOfStream)
+			&& MixChannels(IntermediatePCMData.GetData(), IntermediatePCMData.Num() / SourceNumOfChannels, SourceNumOfChannels, DestinationNumOfChannels, ConvertedPCMData);
+	}
+
+	/**
+	 * Discard the resampler state, so that the next chunk starts a new stream
+	 */
+	void Reset()
+	{
+		Resampler.Reset();
+		SourceSampleRate = 0;
+		DestinationSampleRate = 0;
+		NumOfResampledChannels = 0;
+		NumOfSourceChannels = 0;
+		NumOfDestinationChannels = 0;
+	}
+
+	/**
+	 * Whether a stream is being resampled, i.e. whether the resampler may hold back frames until the end of the stream
+	 */
+	bool IsResampling() const
+	{
+		return Resampler.IsValid();
+	}
+
+	/**
+	 * Flush the frames held back by the resampler at the end of the stream, converted to the destination format of the stream
+	 *
+	 * @param ConvertedPCMData Interleaved PCM data in the destination format. Empty if no stream is being resampled. Its allocation is reused
+	 * @return True if the frames were successfully flushed
+	 */
+	bool Flush(Audio::FAlignedFloatBuffer& ConvertedPCMData)
+	{
+		if (!IsResampling())
+		{
+			ConvertedPCMData.Reset();
+			return true;
+		}
+
+		return ProcessChunk(nullptr, 0, SourceSampleRate, NumOfSourceChannels, DestinationSampleRate, NumOfDestinationChannels, Quality, ConvertedPCMData, true);
+	}
+
+private:
+	/**
+	 * Resample the next chunk of the stream, (re)initializing the resampler if the format has changed
+	 */
+	bool Resample(const float* PCMData, int32 NumOfFrames, int32 InSourceSampleRate, int32 InDestinationSampleRate, int32 NumOfChannels, ERuntimeResamplingQuality InQuality, Audio::FAlignedFloatBuffer& ResampledPCMData, bool bEndOfStream)
+	{
+		const float SampleRateRatio = static_cast<float>(InDestinationSampleRate) / static_cast<float>(InSourceSampleRate);
+
+		if (!Resampler.IsValid() || SourceSampleRate != InSourceSampleRate || DestinationSampleRate != InDestinationSampleRate || NumOfResampledChannels != NumOfChannels || Quality != InQuality)
+		{
+			Resampler = MakeUnique<Audio::FResampler>();
+			Resampler->Init(FRAW_RuntimeCodec::GetResamplingMethod(InQuality), SampleRateRatio, NumOfChannels);
+
+			SourceSampleRate = InSourceSampleRate;
+			DestinationSampleRate = InDestinationSampleRate;
+			NumOfResampledChannels = NumOfChannels;
+			Quality = InQuality;
+		}
+
+		// The resampler may also output frames held back from the previous chunks, so there is room for more than the proportional number of frames
+		const int32 MaxNumOfOutputFrames = FMath::CeilToInt((NumOfFrames + MaxNumOfHeldBackFrames) * SampleRateRatio) + 1;
+		ResampledPCMData.SetNumUninitialized(MaxNumOfOutputFrames * NumOfChannels);
+
+		// The resampler only reads the input, it is not const-qualified in the engine API. It also rejects a null input, even when flushing without any frames
+		float EmptyInput = 0.f;
+		float* InputPCMData = PCMData ? const_cast<float*>(PCMData) : &EmptyInput;
+
+		int32 NumOfOutputFrames = 0;
+		const int32 ErrorCode = Resampler->ProcessAudio(InputPCMData, NumOfFrames, bEndOfStream, ResampledPCMData.GetData(), MaxNumOfOutputFrames, NumOfOutputFrames);
+		if (ErrorCode != 0)
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to resample streamed audio data from %d to %d (error code %d)"), InSourceSampleRate, InDestinationSampleRate, ErrorCode);
+			Reset();
+			return false;
+		}
+
+		ResampledPCMData.SetNumUninitialized(NumOfOutputFrames * NumOfChannels);
+
+		// The next chunk starts a new stream
+		if (bEndOfStream)
+		{
+			Reset();
+		}
+		return true;
+	}
+
+	/**
+	 * Mix the channels of the chunk into the reused output buffer
+	 * The channels are mapped the same way as in MixChannelsRAWData (Audio::TSampleBuffer::MixBufferToChannels): each source channel is added to the destination channel
+	 * at its index modulo the number of destination channels, so streamed and non-streamed audio data is mixed at the same levels
+	 */
+	static bool MixChannels(const float* PCMData, int32 NumOfFrames, int32 SourceNumOfChannels, int32 DestinationNumOfChannels, Audio::FAlignedFloatBuffer& MixedPCMData)
+	{
+		MixedPCMData.SetNumUninitialized(NumOfFrames * DestinationNumOfChannels);
+		float* MixedPCMDataPtr = MixedPCMData.GetData();
+
+		if (SourceNumOfChannels == DestinationNumOfChannels)
+		{
+			FMemory::Memcpy(MixedPCMDataPtr, PCMData, NumOfFrames * SourceNumOfChannels * sizeof(float));
+			return true;
+		}
+
+		FMemory::Memzero(MixedPCMDataPtr, NumOfFrames * DestinationNumOfChannels * sizeof(float));
+		for (int32 FrameIndex = 0; FrameIndex < NumOfFrames; ++FrameIndex)
+		{
+			const float* SourceFrame = PCMData + FrameIndex * SourceNumOfChannels;
+			float* MixedFrame = MixedPCMDataPtr + FrameIndex * DestinationNumOfChannels;
+			for (int32 ChannelIndex = 0; ChannelIndex < SourceNumOfChannels; ++ChannelIndex)
+			{
+				MixedFrame[ChannelIndex % DestinationNumOfChannels] += SourceFrame[ChannelIndex];
+			}
+		}
+		return true;
+	}
+
+	/** Upper bound of the number of frames the sinc filter holds back between chunks */
+	static constexpr int32 MaxNumOfHeldBackFrames = 8192;
+
+	/** Engine resampler keeping the filter state between chunks */
+	TUniquePtr<Audio::FResampler> Resampler;
+
+	/** Scratch buffer for the intermediate data between mixing and resampling, reused between chunks */
+	Audio::FAlignedFloatBuffer IntermediatePCMData;
+
+	/** Format the resampler is initialized for */
+	int32 SourceSampleRate;
+	int32 DestinationSampleRate;
+	int32 NumOfResampledChannels;
+	ERuntimeResamplingQuality Quality;
+
+	/** Format of the stream, kept to flush it */
+	int32 NumOfSourceChannels;
+	int32 NumOfDestinationChannels;
 };
@@ -5,7 +5,8 @@
 #include "BaseRuntimeCodec.h"
 
 /**
- * A factory for constructing the codecs used for encoding and decoding audio data
+ * A factory for retrieving the codecs used for encoding and decoding audio data
+ * The codecs are stateless, so a single shared instance of each codec is handed out instead of allocating one per call
  */
 class RUNTIMEAUDIOIMPORTER_API FRuntimeCodecFactory
 {
@@ -19,7 +20,7 @@ public:
 	 * @param FilePath The file path from which to get the codec
 	 * @return The detected codec, or a nullptr if it could not be detected
 	 */
-	virtual TUniquePtr<FBaseRuntimeCodec> GetCodec(const FString& FilePath);
+	virtual FBaseRuntimeCodec* GetCodec(const FString& FilePath);
 
 	/**
 	 * Get the codec based on the audio format
@@ -27,13 +28,22 @@ public:
 	 * @param AudioFormat The format from which to get the codec
 	 * @return The detected codec, or a nullptr if it could not be detected
 	 */
-	virtual TUniquePtr<FBaseRuntimeCodec> GetCodec(ERuntimeAudioFormat AudioFormat);
+	virtual FBaseRuntimeCodec* GetCodec(ERuntimeAudioFormat AudioFormat);
 
 	/**
 	 * Get the codec based on the audio data (slower, but more reliable)
+	 * The header signature is checked first, falling back to probing every codec if the signature is unknown or misleading
 	 *
 	 * @param AudioData The audio data from which to get the codec
 	 * @return The detected codec, or a nullptr if it could not be detected
 	 */
-	virtual TUniquePtr<FBaseRuntimeCodec> GetCodec(const FRuntimeBulkDataBuffer<uint8>& AudioData);
+	virtual FBaseRuntimeCodec* GetCodec(const FRuntimeBulkDataBuffer<uint8>& AudioData);
+
+	/**
+	 * Guess the audio format from the signature at the start of the audio data, without decoding anything
+	 *
+	 * @param AudioData The audio data from which to guess the format
+	 * @return The guessed format, or ERuntimeAudioFormat::Invalid if the signature is not recognized
+	 */
+	virtual ERuntimeAudioFormat DetectAudioFormatFromSignature(const FRuntimeBulkDataBuffer<uint8>& AudioData) const;
 };
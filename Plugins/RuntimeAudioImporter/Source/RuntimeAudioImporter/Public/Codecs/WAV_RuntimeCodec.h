@@ -13,6 +13,7 @@ public:
 	virtual bool GetHeaderInfo(FEncodedAudioStruct EncodedData, FRuntimeAudioHeaderInfo& HeaderInfo) override;
 	virtual bool Encode(FDecodedAudioStruct DecodedData, FEncodedAudioStruct& EncodedData, uint8 Quality) override;
 	virtual bool Decode(FEncodedAudioStruct EncodedData, FDecodedAudioStruct& DecodedData) override;
+	virtual TUniquePtr<FBaseRuntimeStreamDecoder> CreateStreamDecoder(TUniquePtr<IFileHandle>&& FileHandle) override;
 	virtual ERuntimeAudioFormat GetAudioFormat() const override { return ERuntimeAudioFormat::Wav; }
 	//~ End FBaseRuntimeCodec Interface
 };
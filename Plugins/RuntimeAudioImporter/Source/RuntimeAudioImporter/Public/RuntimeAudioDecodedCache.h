@@ -0,0 +1,133 @@
+﻿// Georgy Treshchev 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RuntimeAudioImporterTypes.h"
+
+/**
+ * Process-wide cache of decoded audio data, so that importing the same audio again shares the already decoded PCM data instead of decoding it anew
+ * Entries are keyed by the file path with its modification time and size, or by a hash of the encoded audio data, and evicted in least recently used order once the memory budget is exceeded
+ * Disabled by default (zero memory budget). Thread-safe
+ */
+class RUNTIMEAUDIOIMPORTER_API FRuntimeAudioDecodedCache
+{
+public:
+	/** Cached decoded audio data */
+	struct FEntry
+	{
+		/** Decoded PCM data, shared with the imported sound waves. Must not be modified */
+		TSharedPtr<FPCMStruct> PCMInfo;
+
+		/** Basic information about the decoded audio data */
+		FSoundWaveBasicStruct SoundWaveBasicInfo;
+	};
+
+	/**
+	 * Get the process-wide cache instance
+	 */
+	static FRuntimeAudioDecodedCache& Get();
+
+	/**
+	 * Set the memory budget, evicting entries if the cached data exceeds it
+	 *
+	 * @param InBudgetBytes Maximum size of the cached PCM data, in bytes. Zero disables the cache and releases all entries
+	 */
+	void SetBudget(int64 InBudgetBytes);
+
+	/**
+	 * Whether the cache is enabled, i.e. has a non-zero memory budget
+	 */
+	bool IsEnabled() const;
+
+	/**
+	 * Make a cache key for a file, so that the entry is invalidated once the file is modified
+	 *
+	 * @param FilePath Path to the audio file
+	 * @param AudioFormat Format the file is decoded as
+	 * @return Cache key, or an empty string if the file does not exist
+	 */
+	static FString MakeFileKey(const FString& FilePath, ERuntimeAudioFormat AudioFormat);
+
+	/**
+	 * Make a cache key for encoded audio data by hashing its content
+	 *
+	 * @param AudioData Encoded audio data
+	 * @param NumOfBytes Size of the encoded audio data
+	 * @param AudioFormat Format the data is decoded as
+	 * @return Cache key
+	 */
+	static FString MakeContentKey(const uint8* AudioData, int64 NumOfBytes, ERuntimeAudioFormat AudioFormat);
+
+	/**
+	 * Find the decoded audio data for the key, marking it as the most recently used. Counts as a hit or a miss
+	 *
+	 * @param Key Cache key
+	 * @param OutEntry Found entry
+	 * @return Whether the entry was found or not
+	 */
+	bool Find(const FString& Key, FEntry& OutEntry);
+
+	/**
+	 * Add decoded audio data to the cache, evicting the least recently used entries if the budget is exceeded
+	 * Data larger than the whole budget is not cached
+	 *
+	 * @param Key Cache key
+	 * @param Entry Decoded audio data
+	 */
+	void Add(const FString& Key, const FEntry& Entry);
+
+	/**
+	 * Remove all entries. Sound waves already sharing the decoded audio data keep it alive
+	 */
+	void Empty();
+
+	/**
+	 * Get the cache statistics
+	 */
+	FRuntimeAudioCacheStats GetStats() const;
+
+	/**
+	 * Reset the hit, miss and eviction counters
+	 */
+	void ResetStats();
+
+private:
+	/** Cached entry with its bookkeeping */
+	struct FCachedEntry
+	{
+		FEntry Entry;
+
+		/** Size of the PCM data, in bytes */
+		int64 SizeInBytes;
+
+		/** Value of AccessCounter when the entry was last used */
+		uint64 LastAccess;
+	};
+
+	/**
+	 * Evict the least recently used entries until the cached data fits in the budget
+	 * Should only be used if DataGuard is locked
+	 */
+	void EvictToBudget_Internal();
+
+	/** Cached entries by key */
+	TMap<FString, FCachedEntry> Entries;
+
+	/** Monotonic counter used to order the entries by their last use */
+	uint64 AccessCounter = 0;
+
+	/** Size of the cached PCM data, in bytes */
+	int64 UsedBytes = 0;
+
+	/** Memory budget, in bytes */
+	int64 BudgetBytes = 0;
+
+	/** Statistics counters */
+	int64 NumOfHits = 0;
+	int64 NumOfMisses = 0;
+	int64 NumOfEvictions = 0;
+
+	/** Data guard (mutex) for thread safety */
+	mutable FCriticalSection DataGuard;
+};
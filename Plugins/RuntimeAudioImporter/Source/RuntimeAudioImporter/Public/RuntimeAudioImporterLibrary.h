@@ -8,6 +8,40 @@
 
 class UPreImportedSoundAsset;
 class URuntimeAudioImporterLibrary;
+class UStreamingSoundWave;
+class FBaseRuntimeStreamDecoder;
+struct FRuntimeBatchImportState;
+struct FRuntimeStreamedImportState;
+
+/** Result of importing a single item of a batch import */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FRuntimeBatchImportItemResult
+{
+	GENERATED_BODY()
+
+	FRuntimeBatchImportItemResult()
+		: Index(INDEX_NONE)
+	  , ImportedSoundWave(nullptr)
+	  , Status(ERuntimeImportStatus::FailedToReadAudioDataArray)
+	{
+	}
+
+	/** Index of the item in the batch */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int32 Index;
+
+	/** Path to the imported file. Empty if the item was imported from a buffer */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	FString FilePath;
+
+	/** Imported sound wave. Null if the import failed */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	UImportedSoundWave* ImportedSoundWave;
+
+	/** Importing status */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	ERuntimeImportStatus Status;
+};
 
 /** Static delegate broadcasting the audio importer progress */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnAudioImporterProgressNative, int32);
@@ -21,6 +55,18 @@ DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnAudioImporterResultNative, URuntimeAud
 /** Dynamic delegate broadcasting the audio importer result */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAudioImporterResult, URuntimeAudioImporterLibrary*, Importer, UImportedSoundWave*, ImportedSoundWave, ERuntimeImportStatus, Status);
 
+/** Static delegate broadcasting the batch import progress */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnAudioImporterBatchProgressNative, URuntimeAudioImporterLibrary*, int32, int32);
+
+/** Dynamic delegate broadcasting the batch import progress */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAudioImporterBatchProgress, URuntimeAudioImporterLibrary*, Importer, int32, NumOfCompletedItems, int32, NumOfItems);
+
+/** Static delegate broadcasting the batch import result */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAudioImporterBatchResultNative, URuntimeAudioImporterLibrary*, const TArray<FRuntimeBatchImportItemResult>&);
+
+/** Dynamic delegate broadcasting the batch import result */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAudioImporterBatchResult, URuntimeAudioImporterLibrary*, Importer, const TArray<FRuntimeBatchImportItemResult>&, Results);
+
 /** Static delegate broadcasting the result of the conversion from SoundWave to ImportedSoundWave */
 DECLARE_DELEGATE_TwoParams(FOnRegularToAudioImporterSoundWaveConvertResultNative, bool, UImportedSoundWave*);
 
@@ -52,6 +98,20 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Runtime Audio Importer|Delegates")
 	FOnAudioImporterResult OnResult;
 
+	/** Bind to know when a batch import is on progress, each time an item is completed. Suitable for use in C++ */
+	FOnAudioImporterBatchProgressNative OnBatchProgressNative;
+
+	/** Bind to know when a batch import is on progress, each time an item is completed */
+	UPROPERTY(BlueprintAssignable, Category = "Runtime Audio Importer|Delegates")
+	FOnAudioImporterBatchProgress OnBatchProgress;
+
+	/** Bind to know when a batch import is complete, with the results of all items (even if some of them failed). Suitable for use in C++ */
+	FOnAudioImporterBatchResultNative OnBatchResultNative;
+
+	/** Bind to know when a batch import is complete, with the results of all items (even if some of them failed) */
+	UPROPERTY(BlueprintAssignable, Category = "Runtime Audio Importer|Delegates")
+	FOnAudioImporterBatchResult OnBatchResult;
+
 	/**
 	 * Tries to retrieve audio data from a given regular sound wave
 	 * 
@@ -78,6 +138,41 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (Keywords = "Importer, Transcoder, Converter, Runtime, MP3, FLAC, WAV, OGG, Vorbis"), Category = "Runtime Audio Importer|Import")
 	void ImportAudioFromFile(const FString& FilePath, ERuntimeAudioFormat AudioFormat);
 
+	/**
+	 * Import audio from a file incrementally into a streaming sound wave
+	 * The file is read and decoded chunk by chunk, so the result is broadcast as soon as the first chunk is decoded and the whole encoded file is never held in memory
+	 * Decoding only stays a few chunks ahead of playback, and the played audio data is released automatically (see SetAutoReleasePlayedAudioData), so neither is the whole decoded file
+	 * The decoding stops if either the streaming sound wave or this importer is destroyed before the whole file is decoded
+	 * Only MP3, FLAC, WAV and OGG Vorbis can be decoded incrementally, other formats fall back to ImportAudioFromFile
+	 *
+	 * @param FilePath Path to the audio file to import
+	 * @param AudioFormat Audio format
+	 * @param ChunkDuration Duration of the audio decoded and appended at once, in seconds
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Importer, Transcoder, Converter, Runtime, MP3, FLAC, WAV, OGG, Vorbis, Stream, Streaming"), Category = "Runtime Audio Importer|Import")
+	void ImportAudioFromFileStreamed(const FString& FilePath, ERuntimeAudioFormat AudioFormat, float ChunkDuration = 2.f);
+
+	/**
+	 * Import audio from multiple files in parallel. Bind to OnBatchProgress and OnBatchResult to get the results
+	 * Each file is imported the same way as by ImportAudioFromFile, with at most MaxConcurrency files being loaded and decoded at once
+	 *
+	 * @param FilePaths Paths to the audio files to import
+	 * @param AudioFormat Audio format of all files. Use Auto to detect the format of each file separately
+	 * @param MaxConcurrency Maximum number of files imported at once. Zero or less uses the number of task graph worker threads
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Importer, Transcoder, Converter, Runtime, MP3, FLAC, WAV, OGG, Vorbis, Batch, Multiple, Parallel"), Category = "Runtime Audio Importer|Import")
+	void ImportAudioFromFiles(const TArray<FString>& FilePaths, ERuntimeAudioFormat AudioFormat, int32 MaxConcurrency = 0);
+
+	/**
+	 * Import audio from multiple buffers in parallel. Bind to OnBatchProgress and OnBatchResult to get the results
+	 * Each buffer is imported the same way as by ImportAudioFromBuffer, with at most MaxConcurrency buffers being decoded at once
+	 *
+	 * @param AudioDataArrays Audio data arrays
+	 * @param AudioFormat Audio format of all buffers. Use Auto to detect the format of each buffer separately
+	 * @param MaxConcurrency Maximum number of buffers imported at once. Zero or less uses the number of task graph worker threads
+	 */
+	void ImportAudioFromBuffers(TArray<TArray64<uint8>> AudioDataArrays, ERuntimeAudioFormat AudioFormat, int32 MaxConcurrency = 0);
+
 	/**
 	 * Import audio from a pre-imported sound asset
 	 *
@@ -103,6 +198,52 @@ public:
 	 */
 	void ImportAudioFromBuffer(TArray64<uint8> AudioData, ERuntimeAudioFormat AudioFormat);
 
+	/**
+	 * Set the memory budget of the decoded audio cache. Files and buffers imported again while their decoded audio data is cached share it instead of being decoded anew
+	 * The cache is disabled by default
+	 *
+	 * @param BudgetBytes Maximum size of the cached PCM data, in bytes. Zero disables the cache and releases all cached data
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Cache, Memory, Budget"), Category = "Runtime Audio Importer|Cache")
+	static void SetDecodedAudioCacheBudget(int64 BudgetBytes);
+
+	/**
+	 * Get the statistics of the decoded audio cache
+	 *
+	 * @return Hits, misses, evictions and memory usage of the cache
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Cache, Memory, Stats"), Category = "Runtime Audio Importer|Cache")
+	static FRuntimeAudioCacheStats GetDecodedAudioCacheStats();
+
+	/**
+	 * Release all data held by the decoded audio cache. Sound waves already sharing the decoded audio data keep it alive
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Cache, Memory, Clear"), Category = "Runtime Audio Importer|Cache")
+	static void ClearDecodedAudioCache();
+
+	/**
+	 * Set the memory budget of the scratch buffer pool. Intermediate audio data of decoding and encoding reuses the pooled buffers instead of allocating memory anew
+	 * The pool is enabled with a budget of 16 MB by default
+	 *
+	 * @param BudgetBytes Maximum size of the retained idle buffers, in bytes. Zero disables the pool and frees all idle buffers
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Pool, Memory, Budget"), Category = "Runtime Audio Importer|Memory")
+	static void SetScratchBufferPoolBudget(int64 BudgetBytes);
+
+	/**
+	 * Get the statistics of the scratch buffer pool
+	 *
+	 * @return Hits, misses, discards and retained memory of the pool
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Pool, Memory, Stats"), Category = "Runtime Audio Importer|Memory")
+	static FRuntimeAudioScratchPoolStats GetScratchBufferPoolStats();
+
+	/**
+	 * Free all idle buffers retained by the scratch buffer pool
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Pool, Memory, Clear"), Category = "Runtime Audio Importer|Memory")
+	static void ClearScratchBufferPool();
+
 	/**
 	 * Import audio from a RAW file. The audio data must not have headers and must be uncompressed
 	 *
@@ -189,7 +330,78 @@ public:
 	 */
 	void ImportAudioFromDecodedInfo(FDecodedAudioStruct&& DecodedAudioInfo);
 
+	/**
+	 * Create Imported Sound Wave sharing the decoded PCM data (e.g. from the decoded audio cache) and finish importing
+	 *
+	 * @param SoundWaveBasicInfo Basic information about the PCM data
+	 * @param SharedPCMInfo Shared PCM data
+	 */
+	void ImportAudioFromSharedPCM(const FSoundWaveBasicStruct& SoundWaveBasicInfo, TSharedPtr<FPCMStruct> SharedPCMInfo);
+
+	/**
+	 * Decode the audio data chunk by chunk using the stream decoder and append it to the streaming sound wave, until the decoded audio data is far enough ahead of playback
+	 * The caller must keep both this object and the streaming sound wave alive until it returns
+	 *
+	 * @param StreamedImportState State of the streamed import, including the stream decoder
+	 * @param StreamingSoundWave Streaming sound wave to append the decoded audio data to
+	 * @return Whether the decoding was paused and has to be resumed once playback advances, or has finished
+	 */
+	bool ImportAudioFromStreamDecoder(TSharedRef<FRuntimeStreamedImportState> StreamedImportState, UStreamingSoundWave* StreamingSoundWave);
+
+	/**
+	 * Continue decoding the streamed import in a background thread, and schedule the next continuation if the decoding gets paused
+	 * Stops once the streaming sound wave or this object has been destroyed. Should be called from the game thread
+	 *
+	 * @param StreamedImportState State of the streamed import
+	 */
+	void ContinueStreamedImport_Internal(TSharedRef<FRuntimeStreamedImportState> StreamedImportState);
+
 protected:
+	/**
+	 * Decode the audio data and finish importing, adding the decoded audio data to the decoded audio cache if the cache key is specified
+	 * Should be called from a background thread
+	 *
+	 * @param AudioData Encoded audio data. May wrap a memory-mapped file region
+	 * @param AudioFormat Audio format
+	 * @param CacheKey Key of the decoded audio data in the decoded audio cache. Empty if the data should not be cached
+	 */
+	void ImportAudioFromBuffer_Internal(FRuntimeBulkDataBuffer<uint8>&& AudioData, ERuntimeAudioFormat AudioFormat, const FString& CacheKey);
+
+	/**
+	 * Try to finish importing using the decoded audio data from the decoded audio cache
+	 *
+	 * @param CacheKey Key of the decoded audio data in the decoded audio cache
+	 * @return Whether the decoded audio data was found in the cache and the import was finished using it
+	 */
+	bool TryImportAudioFromCache(const FString& CacheKey);
+
+	/**
+	 * Start the batch import, importing the first items up to the concurrency limit
+	 * Should be called from the game thread
+	 *
+	 * @param BatchState State of the batch import
+	 */
+	void StartBatchImport_Internal(TSharedRef<FRuntimeBatchImportState> BatchState);
+
+	/**
+	 * Start importing the next item of the batch using a separate importer, so the items are imported in parallel
+	 * Should be called from the game thread
+	 *
+	 * @param BatchState State of the batch import
+	 */
+	void ImportNextBatchItem_Internal(TSharedRef<FRuntimeBatchImportState> BatchState);
+
+	/**
+	 * Record the result of a batch item, broadcast the batch progress and continue with the next item or finish the batch
+	 * Should be called from the game thread
+	 *
+	 * @param BatchState State of the batch import
+	 * @param ItemIndex Index of the completed item
+	 * @param ImportedSoundWave Imported sound wave. Null if the import failed
+	 * @param Status Importing status
+	 */
+	void OnBatchItemResult_Internal(TSharedRef<FRuntimeBatchImportState> BatchState, int32 ItemIndex, UImportedSoundWave* ImportedSoundWave, ERuntimeImportStatus Status);
+
 	/**
 	 * Audio transcoding progress callback
 	 * 
@@ -15,6 +15,9 @@
 #include "Sound/SoundGroups.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Misc/ScopeLock.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include <atomic>
 
 #if UE_VERSION_OLDER_THAN(4, 26, 0)
 #include "DSP/BufferVectorOperations.h"
@@ -98,6 +101,20 @@ enum class ERuntimeRAWAudioFormat : uint8
 	Float32 UMETA(DisplayName = "Floating point 32-bit")
 };
 
+/** Possible resampling qualities, from the cheapest to the most accurate */
+UENUM(BlueprintType, Category = "Runtime Audio Importer")
+enum class ERuntimeResamplingQuality : uint8
+{
+	/** Linear interpolation. Cheapest, suitable for speech and real-time capture */
+	Linear UMETA(DisplayName = "Linear"),
+
+	/** Band-limited sinc interpolation with a short filter */
+	SincFast UMETA(DisplayName = "Sinc (fast)"),
+
+	/** Band-limited sinc interpolation with the longest filter. Most accurate and most expensive */
+	BestSinc UMETA(DisplayName = "Sinc (best)")
+};
+
 /**
  * An alternative to FBulkDataBuffer with consistent data types
  */
@@ -111,9 +128,15 @@ public:
 	using ViewType = TArrayView64<DataType>;
 #endif
 
-	FRuntimeBulkDataBuffer() = default;
+	FRuntimeBulkDataBuffer()
+		: Capacity(0)
+		, NumOfReleasedElements(0)
+	{
+	}
 
 	FRuntimeBulkDataBuffer(const FRuntimeBulkDataBuffer& Other)
+		: Capacity(0)
+		, NumOfReleasedElements(0)
 	{
 		*this = Other;
 	}
@@ -121,11 +144,37 @@ public:
 	FRuntimeBulkDataBuffer(FRuntimeBulkDataBuffer&& Other) noexcept
 	{
 		View = MoveTemp(Other.View);
+		Capacity = Other.Capacity;
+		NumOfReleasedElements = Other.NumOfReleasedElements;
+		ReleaseExternalBuffer = MoveTemp(Other.ReleaseExternalBuffer);
 		Other.View = ViewType();
+		Other.Capacity = 0;
+		Other.NumOfReleasedElements = 0;
 	}
 
 	FRuntimeBulkDataBuffer(DataType* InBuffer, int64 InNumberOfElements)
 		: View(InBuffer, InNumberOfElements)
+		, Capacity(InNumberOfElements)
+		, NumOfReleasedElements(0)
+	{
+#if UE_VERSION_OLDER_THAN(4, 27, 0)
+		check(InNumberOfElements <= TNumericLimits<int32>::Max())
+#endif
+	}
+
+	/**
+	 * Wrap memory owned elsewhere (e.g. a memory-mapped file region) without copying it
+	 * The memory is treated as read-only: it is copied into an owned allocation before the first modification
+	 *
+	 * @param InBuffer Memory to wrap
+	 * @param InNumberOfElements Number of elements in the memory
+	 * @param InReleaseExternalBuffer Called once the buffer no longer references the memory
+	 */
+	FRuntimeBulkDataBuffer(DataType* InBuffer, int64 InNumberOfElements, TUniqueFunction<void()>&& InReleaseExternalBuffer)
+		: View(InBuffer, InNumberOfElements)
+		, Capacity(InNumberOfElements)
+		, NumOfReleasedElements(0)
+		, ReleaseExternalBuffer(MoveTemp(InReleaseExternalBuffer))
 	{
 #if UE_VERSION_OLDER_THAN(4, 27, 0)
 		check(InNumberOfElements <= TNumericLimits<int32>::Max())
@@ -134,6 +183,8 @@ public:
 
 	template <typename Allocator>
 	explicit FRuntimeBulkDataBuffer(const TArray<DataType, Allocator>& Other)
+		: Capacity(0)
+		, NumOfReleasedElements(0)
 	{
 		const int64 BulkDataSize = Other.Num();
 
@@ -145,6 +196,7 @@ public:
 
 		FMemory::Memcpy(BulkData, Other.GetData(), BulkDataSize * sizeof(DataType));
 		View = ViewType(BulkData, BulkDataSize);
+		Capacity = BulkDataSize;
 	}
 
 	~FRuntimeBulkDataBuffer()
@@ -164,6 +216,7 @@ public:
 			FMemory::Memcpy(BufferCopy, Other.View.GetData(), BufferSize * sizeof(DataType));
 
 			View = ViewType(BufferCopy, BufferSize);
+			Capacity = BufferSize;
 		}
 
 		return *this;
@@ -176,7 +229,12 @@ public:
 			FreeBuffer();
 
 			View = Other.View;
+			Capacity = Other.Capacity;
+			NumOfReleasedElements = Other.NumOfReleasedElements;
+			ReleaseExternalBuffer = MoveTemp(Other.ReleaseExternalBuffer);
 			Other.View = ViewType();
+			Other.Capacity = 0;
+			Other.NumOfReleasedElements = 0;
 		}
 
 		return *this;
@@ -197,6 +255,7 @@ public:
 #endif
 
 		View = ViewType(InBuffer, InNumberOfElements);
+		Capacity = InNumberOfElements;
 	}
 
 	const ViewType& GetView() const
@@ -204,17 +263,369 @@ public:
 		return View;
 	}
 
+	/**
+	 * Check whether the buffer wraps memory owned elsewhere rather than its own allocation
+	 */
+	bool IsExternal() const
+	{
+		return static_cast<bool>(ReleaseExternalBuffer);
+	}
+
+	/**
+	 * Copy the wrapped external memory into an owned allocation, so it can be modified or reallocated
+	 * Must be called before writing through the view of an external buffer, since the external memory may be read-only (e.g. a memory-mapped file)
+	 *
+	 * @return Whether the owned allocation was made
+	 */
+	bool MakeOwned()
+	{
+		const int64 NumberOfElements = View.Num();
+		DataType* OwnedBuffer = static_cast<DataType*>(FMemory::Malloc(FMath::Max<int64>(NumberOfElements, 1) * sizeof(DataType)));
+		if (!OwnedBuffer)
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(OwnedBuffer, View.GetData(), NumberOfElements * sizeof(DataType));
+		FreeBuffer();
+		View = ViewType(OwnedBuffer, NumberOfElements);
+		Capacity = NumberOfElements;
+		return true;
+	}
+
+	/**
+	 * Get the number of elements the current allocation can hold, starting from the first element, without reallocating
+	 */
+	int64 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	/**
+	 * Make sure the allocation can hold at least the specified number of elements, keeping the existing elements
+	 *
+	 * @param NewCapacity Number of elements to make room for
+	 * @return Whether the allocation can hold the specified number of elements
+	 */
+	bool Reserve(int64 NewCapacity)
+	{
+		if (NewCapacity <= Capacity)
+		{
+			return true;
+		}
+
+		if (IsExternal() && !MakeOwned())
+		{
+			return false;
+		}
+
+		// Reusing the space of the released elements first, which may already be enough
+		Compact();
+		if (NewCapacity <= Capacity)
+		{
+			return true;
+		}
+
+#if UE_VERSION_OLDER_THAN(4, 27, 0)
+		if (NewCapacity > TNumericLimits<int32>::Max())
+		{
+			return false;
+		}
+#endif
+
+		DataType* NewBuffer = static_cast<DataType*>(FMemory::Realloc(View.GetData(), NewCapacity * sizeof(DataType)));
+		if (!NewBuffer)
+		{
+			return false;
+		}
+
+		View = ViewType(NewBuffer, View.Num());
+		Capacity = NewCapacity;
+		return true;
+	}
+
+	/**
+	 * Append elements to the end, growing the allocation geometrically so that the cost of repeated appends is amortized constant per element
+	 *
+	 * @param InBuffer Elements to append
+	 * @param InNumberOfElements Number of elements to append
+	 * @return Whether the elements were appended
+	 */
+	bool Append(const DataType* InBuffer, int64 InNumberOfElements)
+	{
+		const int64 NewNumberOfElements = View.Num() + InNumberOfElements;
+		if (NewNumberOfElements > Capacity && !Reserve(FMath::Max<int64>(NewNumberOfElements, Capacity * 2)) && !Reserve(NewNumberOfElements))
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(View.GetData() + View.Num(), InBuffer, InNumberOfElements * sizeof(DataType));
+		View = ViewType(View.GetData(), NewNumberOfElements);
+		return true;
+	}
+
+	/**
+	 * Remove elements from the start by advancing the start of the buffer within the existing allocation, without moving the remaining elements
+	 * The remaining elements are only moved to the beginning of the allocation once the released space exceeds them, so the cost is amortized constant per removed element
+	 * The allocation is only shrunk at that point if it is more than four times larger than needed, so that interleaved appends and removals do not reallocate each time
+	 *
+	 * @param InNumberOfElements Number of elements to remove
+	 */
+	void RemoveFromStart(int64 InNumberOfElements)
+	{
+		InNumberOfElements = FMath::Clamp<int64>(InNumberOfElements, 0, View.Num());
+		if (InNumberOfElements == View.Num())
+		{
+			Empty();
+			return;
+		}
+
+		const int64 NewNumberOfElements = View.Num() - InNumberOfElements;
+		View = ViewType(View.GetData() + InNumberOfElements, NewNumberOfElements);
+		Capacity -= InNumberOfElements;
+		NumOfReleasedElements += InNumberOfElements;
+
+		// The external memory is released as a whole, so there is nothing to reclaim until then
+		if (IsExternal() || NumOfReleasedElements <= NewNumberOfElements)
+		{
+			return;
+		}
+
+		Compact();
+
+		if (Capacity > NewNumberOfElements * 4)
+		{
+			if (DataType* NewBuffer = static_cast<DataType*>(FMemory::Realloc(View.GetData(), NewNumberOfElements * 2 * sizeof(DataType))))
+			{
+				View = ViewType(NewBuffer, NewNumberOfElements);
+				Capacity = NewNumberOfElements * 2;
+			}
+		}
+	}
+
 private:
 	void FreeBuffer()
 	{
-		if (View.GetData() != nullptr)
+		if (IsExternal())
 		{
-			FMemory::Free(View.GetData());
+			ReleaseExternalBuffer();
+			ReleaseExternalBuffer = nullptr;
 			View = ViewType();
 		}
+		else if (View.GetData() != nullptr)
+		{
+			FMemory::Free(View.GetData() - NumOfReleasedElements);
+			View = ViewType();
+		}
+		Capacity = 0;
+		NumOfReleasedElements = 0;
+	}
+
+	/**
+	 * Move the elements to the beginning of the allocation, reclaiming the space of the elements removed from the start
+	 */
+	void Compact()
+	{
+		if (NumOfReleasedElements == 0 || IsExternal())
+		{
+			return;
+		}
+
+		DataType* AllocationStart = View.GetData() - NumOfReleasedElements;
+		FMemory::Memmove(AllocationStart, View.GetData(), View.Num() * sizeof(DataType));
+		View = ViewType(AllocationStart, View.Num());
+		Capacity += NumOfReleasedElements;
+		NumOfReleasedElements = 0;
 	}
 
 	ViewType View;
+
+	/** Number of elements the allocation can hold, starting from the beginning of the view. The view only covers the elements in use */
+	int64 Capacity;
+
+	/** Number of elements removed from the start whose space precedes the view and has not been reclaimed yet */
+	int64 NumOfReleasedElements;
+
+	/** Releases the wrapped memory if it is owned elsewhere. Unset if the buffer owns its allocation */
+	TUniqueFunction<void()> ReleaseExternalBuffer;
+};
+
+namespace RuntimeAudioImporter
+{
+	/**
+	 * Load the audio file into a bulk data buffer without an intermediate array
+	 * The file is memory-mapped where the platform supports it, so the codecs read the encoded data directly from the mapped region instead of a heap copy
+	 * The mapped region is read-only, so the loaded buffer must be made owned (see FRuntimeBulkDataBuffer::MakeOwned) before being modified
+	 * Otherwise, the file is read into a single heap allocation
+	 *
+	 * @param AudioData Loaded audio data
+	 * @param FilePath Path to the audio file
+	 * @return True if the file was loaded
+	 */
+	inline bool LoadAudioFileToBulkData(FRuntimeBulkDataBuffer<uint8>& AudioData, const FString& FilePath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		TUniquePtr<IMappedFileHandle> MappedFileHandle(PlatformFile.OpenMapped(*FilePath));
+		if (MappedFileHandle.IsValid() && MappedFileHandle->GetFileSize() > 0)
+		{
+			TUniquePtr<IMappedFileRegion> MappedFileRegion(MappedFileHandle->MapRegion(0, MappedFileHandle->GetFileSize()));
+			if (MappedFileRegion.IsValid())
+			{
+				uint8* MappedData = const_cast<uint8*>(MappedFileRegion->GetMappedPtr());
+				const int64 MappedSize = MappedFileRegion->GetMappedSize();
+
+				// The region must be unmapped before its file handle is closed
+				AudioData = FRuntimeBulkDataBuffer<uint8>(MappedData, MappedSize, [MappedFileHandle = MoveTemp(MappedFileHandle), MappedFileRegion = MoveTemp(MappedFileRegion)]() mutable
+				{
+					MappedFileRegion.Reset();
+					MappedFileHandle.Reset();
+				});
+				return true;
+			}
+		}
+
+		TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*FilePath));
+		if (!FileHandle.IsValid() || FileHandle->Size() <= 0)
+		{
+			return false;
+		}
+
+		const int64 FileSize = FileHandle->Size();
+		uint8* FileData = static_cast<uint8*>(FMemory::Malloc(FileSize));
+		if (!FileData || !FileHandle->Read(FileData, FileSize))
+		{
+			FMemory::Free(FileData);
+			return false;
+		}
+
+		AudioData = FRuntimeBulkDataBuffer<uint8>(FileData, FileSize);
+		return true;
+	}
+}
+
+/**
+ * Single-producer single-consumer ring buffer of 32-bit float PCM samples
+ * The consumer side never locks or allocates, so it can be used from the audio render thread
+ * Multiple producers are allowed only if they are serialized externally (e.g. by a critical section)
+ */
+class FRuntimePCMRingBuffer
+{
+public:
+	FRuntimePCMRingBuffer()
+		: ReadIndex(0)
+		, WriteIndex(0)
+	{
+	}
+
+	/**
+	 * Allocate the storage. Not thread-safe, must be called before the buffer is shared between threads
+	 *
+	 * @param MinNumOfSamples Minimum number of samples the buffer should be able to hold. Rounded up to a power of two
+	 */
+	void Initialize(uint32 MinNumOfSamples)
+	{
+		Buffer.SetNumZeroed(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(MinNumOfSamples, 1)));
+		ReadIndex.store(0, std::memory_order_relaxed);
+		WriteIndex.store(0, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Check whether the storage has been allocated
+	 */
+	bool IsInitialized() const
+	{
+		return Buffer.Num() > 0;
+	}
+
+	/**
+	 * Get the maximum number of samples the buffer can hold
+	 */
+	uint32 GetCapacity() const
+	{
+		return Buffer.Num();
+	}
+
+	/**
+	 * Get the number of samples available for reading. Exact for the consumer, a lower bound for the producer
+	 */
+	uint32 Num() const
+	{
+		return static_cast<uint32>(WriteIndex.load(std::memory_order_acquire) - ReadIndex.load(std::memory_order_acquire));
+	}
+
+	/**
+	 * Write samples to the buffer. Producer only
+	 *
+	 * @param Samples Samples to write
+	 * @param NumOfSamples Number of samples to write
+	 * @return The number of samples written, less than NumOfSamples if the buffer is full
+	 */
+	uint32 Push(const float* Samples, uint32 NumOfSamples)
+	{
+		const uint64 CurrentWriteIndex = WriteIndex.load(std::memory_order_relaxed);
+		const uint64 CurrentReadIndex = ReadIndex.load(std::memory_order_acquire);
+		const uint32 NumOfSamplesToPush = FMath::Min<uint32>(NumOfSamples, GetCapacity() - static_cast<uint32>(CurrentWriteIndex - CurrentReadIndex));
+
+		WriteSamples(Samples, CurrentWriteIndex, NumOfSamplesToPush);
+		WriteIndex.store(CurrentWriteIndex + NumOfSamplesToPush, std::memory_order_release);
+		return NumOfSamplesToPush;
+	}
+
+	/**
+	 * Read samples from the buffer. Consumer only
+	 *
+	 * @param OutSamples Memory to read the samples into, or a nullptr to discard them
+	 * @param NumOfSamples Maximum number of samples to read
+	 * @return The number of samples read
+	 */
+	uint32 Pop(float* OutSamples, uint32 NumOfSamples)
+	{
+		const uint64 CurrentReadIndex = ReadIndex.load(std::memory_order_relaxed);
+		const uint64 CurrentWriteIndex = WriteIndex.load(std::memory_order_acquire);
+		const uint32 NumOfSamplesToPop = FMath::Min<uint32>(NumOfSamples, static_cast<uint32>(CurrentWriteIndex - CurrentReadIndex));
+
+		if (OutSamples)
+		{
+			ReadSamples(OutSamples, CurrentReadIndex, NumOfSamplesToPop);
+		}
+		ReadIndex.store(CurrentReadIndex + NumOfSamplesToPop, std::memory_order_release);
+		return NumOfSamplesToPop;
+	}
+
+private:
+	/**
+	 * Copy samples into the buffer starting at the given index, wrapping around the end of the buffer
+	 */
+	void WriteSamples(const float* Samples, uint64 Index, uint32 NumOfSamples)
+	{
+		const uint32 BufferIndex = static_cast<uint32>(Index & (GetCapacity() - 1));
+		const uint32 NumOfSamplesBeforeWrap = FMath::Min<uint32>(NumOfSamples, GetCapacity() - BufferIndex);
+
+		FMemory::Memcpy(Buffer.GetData() + BufferIndex, Samples, NumOfSamplesBeforeWrap * sizeof(float));
+		FMemory::Memcpy(Buffer.GetData(), Samples + NumOfSamplesBeforeWrap, (NumOfSamples - NumOfSamplesBeforeWrap) * sizeof(float));
+	}
+
+	/**
+	 * Copy samples out of the buffer starting at the given index, wrapping around the end of the buffer
+	 */
+	void ReadSamples(float* OutSamples, uint64 Index, uint32 NumOfSamples) const
+	{
+		const uint32 BufferIndex = static_cast<uint32>(Index & (GetCapacity() - 1));
+		const uint32 NumOfSamplesBeforeWrap = FMath::Min<uint32>(NumOfSamples, GetCapacity() - BufferIndex);
+
+		FMemory::Memcpy(OutSamples, Buffer.GetData() + BufferIndex, NumOfSamplesBeforeWrap * sizeof(float));
+		FMemory::Memcpy(OutSamples + NumOfSamplesBeforeWrap, Buffer.GetData(), (NumOfSamples - NumOfSamplesBeforeWrap) * sizeof(float));
+	}
+
+	/** Sample storage. The number of samples is always a power of two */
+	TArray<float> Buffer;
+
+	/** Total number of samples read so far. Written by the consumer only */
+	std::atomic<uint64> ReadIndex;
+
+	/** Total number of samples written so far. Written by the producer only */
+	std::atomic<uint64> WriteIndex;
 };
 
 /** Basic sound wave data */
@@ -461,6 +872,172 @@ struct FRuntimeAudioInputDeviceInfo
 	bool bSupportsHardwareAEC;
 };
 
+/** Audio capture statistics */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FRuntimeAudioCaptureStats
+{
+	GENERATED_BODY()
+
+	FRuntimeAudioCaptureStats()
+		: LastLatency(0.f)
+	  , AverageLatency(0.f)
+	  , MaxLatency(0.f)
+	  , NumOfCaptureCallbacks(0)
+	  , NumOfDroppedFrames(0)
+	  , NumOfOverflows(0)
+	  , NumOfBufferOverflows(0)
+	{
+	}
+
+	/**
+	 * Converts Audio Capture Stats to a readable format
+	 *
+	 * @return String representation of the Audio Capture Stats
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Last latency: %f, average latency: %f, max latency: %f, number of capture callbacks: %lld, number of dropped frames: %lld, number of overflows: %d, number of buffer overflows: %d"),
+							   LastLatency, AverageLatency, MaxLatency, NumOfCaptureCallbacks, NumOfDroppedFrames, NumOfOverflows, NumOfBufferOverflows);
+	}
+
+	/** Estimated capture-to-playback latency of the most recently captured audio data, sec. Includes the capture buffer and the audio data queued for playback */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float LastLatency;
+
+	/** Average estimated capture-to-playback latency, sec */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float AverageLatency;
+
+	/** Maximum estimated capture-to-playback latency, sec */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float MaxLatency;
+
+	/** Number of capture callbacks whose audio data was appended to the sound wave */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfCaptureCallbacks;
+
+	/** Number of captured frames dropped because the capture buffer was full */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfDroppedFrames;
+
+	/** Number of overflows reported by the capture device */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int32 NumOfOverflows;
+
+	/** Number of capture callbacks whose audio data did not fit into the capture buffer, see NumOfDroppedFrames */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int32 NumOfBufferOverflows;
+};
+
+/** Decoded audio cache statistics */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FRuntimeAudioCacheStats
+{
+	GENERATED_BODY()
+
+	FRuntimeAudioCacheStats()
+		: NumOfHits(0)
+	  , NumOfMisses(0)
+	  , NumOfEvictions(0)
+	  , NumOfEntries(0)
+	  , UsedBytes(0)
+	  , BudgetBytes(0)
+	{
+	}
+
+	/**
+	 * Converts Audio Cache Stats to a readable format
+	 *
+	 * @return String representation of the Audio Cache Stats
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Hits: %lld, misses: %lld, evictions: %lld, entries: %d, used bytes: %lld, budget bytes: %lld"),
+							   NumOfHits, NumOfMisses, NumOfEvictions, NumOfEntries, UsedBytes, BudgetBytes);
+	}
+
+	/** Number of imports served from the cache */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfHits;
+
+	/** Number of imports that had to be decoded */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfMisses;
+
+	/** Number of entries evicted to stay within the memory budget */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfEvictions;
+
+	/** Number of cached entries */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int32 NumOfEntries;
+
+	/** Size of the cached PCM data, in bytes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 UsedBytes;
+
+	/** Memory budget of the cache, in bytes. The cache is disabled if zero */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 BudgetBytes;
+};
+
+/** Statistics of the scratch buffer pool used for intermediate audio data */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FRuntimeAudioScratchPoolStats
+{
+	GENERATED_BODY()
+
+	FRuntimeAudioScratchPoolStats()
+		: NumOfHits(0)
+	  , NumOfMisses(0)
+	  , NumOfDiscards(0)
+	  , NumOfRetainedBuffers(0)
+	  , RetainedBytes(0)
+	  , PeakRetainedBytes(0)
+	  , BudgetBytes(0)
+	{
+	}
+
+	/**
+	 * Converts Scratch Pool Stats to a readable format
+	 *
+	 * @return String representation of the Scratch Pool Stats
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Hits: %lld, misses: %lld, discards: %lld, retained buffers: %d, retained bytes: %lld, peak retained bytes: %lld, budget bytes: %lld"),
+							   NumOfHits, NumOfMisses, NumOfDiscards, NumOfRetainedBuffers, RetainedBytes, PeakRetainedBytes, BudgetBytes);
+	}
+
+	/** Number of scratch buffers reused from the pool */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfHits;
+
+	/** Number of scratch buffers that had to be allocated */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfMisses;
+
+	/** Number of released scratch buffers freed instead of retained, to stay within the memory budget */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 NumOfDiscards;
+
+	/** Number of idle buffers retained by the pool */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int32 NumOfRetainedBuffers;
+
+	/** Size of the idle buffers retained by the pool, in bytes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 RetainedBytes;
+
+	/** Highest size of the idle buffers retained by the pool since the stats were reset, in bytes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 PeakRetainedBytes;
+
+	/** Memory budget of the pool, in bytes. The pool is disabled if zero */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 BudgetBytes;
+};
+
 /** Audio header information */
 USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
 struct FRuntimeAudioHeaderInfo
@@ -508,6 +1085,30 @@ struct FRuntimeAudioHeaderInfo
 	ERuntimeAudioFormat AudioFormat;
 };
 
+/** Audio header information of a file found while scanning a directory */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FRuntimeAudioFileHeaderInfo
+{
+	GENERATED_BODY()
+
+	FRuntimeAudioFileHeaderInfo()
+		: bSucceeded(false)
+	{
+	}
+
+	/** Path to the audio file */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	FString FilePath;
+
+	/** Whether the header information was retrieved successfully */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	bool bSucceeded;
+
+	/** Audio header information. Valid only if bSucceeded is true */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	FRuntimeAudioHeaderInfo HeaderInfo;
+};
+
 /** Audio export override options */
 USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
 struct FRuntimeAudioExportOverrideOptions
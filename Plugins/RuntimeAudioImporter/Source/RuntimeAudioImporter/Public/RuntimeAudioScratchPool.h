@@ -0,0 +1,225 @@
+﻿// Georgy Treshchev 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RuntimeAudioImporterTypes.h"
+
+/**
+ * Process-wide pool of aligned scratch buffers for intermediate audio data (e.g. 16-bit PCM passed to or returned by the encoders and decoders), so that frequent decoding and encoding reuses memory instead of allocating it anew on each call
+ * Buffers are grouped into power-of-two size classes, and idle buffers are retained only up to the memory budget. Thread-safe
+ */
+class RUNTIMEAUDIOIMPORTER_API FRuntimeAudioScratchPool
+{
+public:
+	/** Alignment of the scratch buffers, in bytes */
+	static constexpr uint32 Alignment = 16;
+
+	~FRuntimeAudioScratchPool();
+
+	/**
+	 * Get the process-wide pool instance
+	 */
+	static FRuntimeAudioScratchPool& Get();
+
+	/**
+	 * Acquire a scratch buffer, reusing an idle one if available
+	 * Buffers larger than the whole budget bypass the pool
+	 *
+	 * @param NumOfBytes Minimum size of the buffer, in bytes
+	 * @param OutCapacity Actual size of the buffer, in bytes, which must be passed to Release
+	 * @return Acquired buffer, or nullptr if NumOfBytes is not positive or the allocation failed
+	 */
+	void* Acquire(int64 NumOfBytes, int64& OutCapacity);
+
+	/**
+	 * Return a scratch buffer to the pool. The buffer is freed instead if retaining it would exceed the budget
+	 *
+	 * @param Buffer Buffer acquired from the pool
+	 * @param Capacity Capacity of the buffer as returned by Acquire
+	 */
+	void Release(void* Buffer, int64 Capacity);
+
+	/**
+	 * Set the memory budget, freeing idle buffers if the retained memory exceeds it
+	 *
+	 * @param InBudgetBytes Maximum size of the retained idle buffers, in bytes. Zero disables the pool
+	 */
+	void SetBudget(int64 InBudgetBytes);
+
+	/**
+	 * Free all idle buffers. Buffers in use are returned to the pool as usual
+	 */
+	void Empty();
+
+	/**
+	 * Get the pool statistics
+	 */
+	FRuntimeAudioScratchPoolStats GetStats() const;
+
+	/**
+	 * Reset the hit, miss and discard counters, and the peak retained memory
+	 */
+	void ResetStats();
+
+private:
+	/** Size of the smallest size class, in bytes. Smaller requests are rounded up to it */
+	static constexpr int64 MinSizeClassBytes = 64 * 1024;
+
+	/** Number of size classes, starting from MinSizeClassBytes */
+	static constexpr int32 NumOfSizeClasses = 32;
+
+	/**
+	 * Get the size class index for a power-of-two capacity
+	 *
+	 * @return Size class index, or INDEX_NONE if the capacity does not belong to any size class
+	 */
+	static int32 GetSizeClassIndex(int64 Capacity);
+
+	/**
+	 * Remove idle buffers, largest first, until the retained memory fits in the budget
+	 * Should only be used if DataGuard is locked
+	 *
+	 * @param OutBuffersToFree Removed buffers, to be freed once DataGuard is unlocked
+	 */
+	void TrimToBudget_Internal(TArray<void*>& OutBuffersToFree);
+
+	/** Idle buffers by size class */
+	TArray<void*> FreeBuffers[NumOfSizeClasses];
+
+	/** Size of the idle buffers, in bytes */
+	int64 RetainedBytes = 0;
+
+	/** Memory budget, in bytes */
+	int64 BudgetBytes = 16 * 1024 * 1024;
+
+	/** Statistics counters */
+	int64 NumOfHits = 0;
+	int64 NumOfMisses = 0;
+	int64 NumOfDiscards = 0;
+	int64 PeakRetainedBytes = 0;
+
+	/** Data guard (mutex) for thread safety */
+	mutable FCriticalSection DataGuard;
+};
+
+/**
+ * Scratch buffer acquired from FRuntimeAudioScratchPool and returned to it once destroyed
+ * The contents are uninitialized
+ */
+template <typename DataType>
+class TRuntimeAudioScratchBuffer
+{
+public:
+	TRuntimeAudioScratchBuffer()
+		: Data(nullptr)
+		, NumOfElements(0)
+		, Capacity(0)
+	{
+	}
+
+	explicit TRuntimeAudioScratchBuffer(int64 InNumOfElements)
+		: Data(nullptr)
+		, NumOfElements(0)
+		, Capacity(0)
+	{
+		Data = static_cast<DataType*>(FRuntimeAudioScratchPool::Get().Acquire(InNumOfElements * sizeof(DataType), Capacity));
+		if (Data)
+		{
+			NumOfElements = InNumOfElements;
+		}
+	}
+
+	TRuntimeAudioScratchBuffer(const TRuntimeAudioScratchBuffer&) = delete;
+	TRuntimeAudioScratchBuffer& operator=(const TRuntimeAudioScratchBuffer&) = delete;
+
+	TRuntimeAudioScratchBuffer(TRuntimeAudioScratchBuffer&& Other) noexcept
+		: Data(Other.Data)
+		, NumOfElements(Other.NumOfElements)
+		, Capacity(Other.Capacity)
+	{
+		Other.Data = nullptr;
+		Other.NumOfElements = 0;
+		Other.Capacity = 0;
+	}
+
+	TRuntimeAudioScratchBuffer& operator=(TRuntimeAudioScratchBuffer&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Reset();
+			Data = Other.Data;
+			NumOfElements = Other.NumOfElements;
+			Capacity = Other.Capacity;
+			Other.Data = nullptr;
+			Other.NumOfElements = 0;
+			Other.Capacity = 0;
+		}
+		return *this;
+	}
+
+	~TRuntimeAudioScratchBuffer()
+	{
+		Reset();
+	}
+
+	/**
+	 * Return the buffer to the pool
+	 */
+	void Reset()
+	{
+		if (Data)
+		{
+			FRuntimeAudioScratchPool::Get().Release(Data, Capacity);
+			Data = nullptr;
+		}
+		NumOfElements = 0;
+		Capacity = 0;
+	}
+
+	/**
+	 * Hand the buffer over to a bulk data buffer, which returns it to the pool once it no longer references it
+	 * Suitable for short-lived decoded data, since the pooled memory is not reused while the bulk data buffer is alive
+	 *
+	 * @return Bulk data buffer wrapping the scratch buffer. Empty if the scratch buffer is not valid
+	 */
+	FRuntimeBulkDataBuffer<DataType> ToBulkDataBuffer()
+	{
+		if (!Data)
+		{
+			return FRuntimeBulkDataBuffer<DataType>();
+		}
+
+		FRuntimeBulkDataBuffer<DataType> BulkDataBuffer(Data, NumOfElements, [Buffer = Data, BufferCapacity = Capacity]()
+		{
+			FRuntimeAudioScratchPool::Get().Release(Buffer, BufferCapacity);
+		});
+
+		Data = nullptr;
+		NumOfElements = 0;
+		Capacity = 0;
+		return BulkDataBuffer;
+	}
+
+	bool IsValid() const
+	{
+		return Data != nullptr;
+	}
+
+	DataType* GetData() const
+	{
+		return Data;
+	}
+
+	int64 Num() const
+	{
+		return NumOfElements;
+	}
+
+private:
+	DataType* Data;
+	int64 NumOfElements;
+
+	/** Capacity of the buffer as returned by the pool, in bytes */
+	int64 Capacity;
+};
@@ -144,4 +144,16 @@ public:
 	 * @param Result Delegate broadcasting the result
 	 */
 	static void TranscodeEncodedDataFromFile(const FString& FilePathFrom, ERuntimeAudioFormat EncodedFormatFrom, const FString& FilePathTo, ERuntimeAudioFormat EncodedFormatTo, uint8 Quality, const FRuntimeAudioExportOverrideOptions& OverrideOptions, const FOnEncodedDataTranscodeFromFileResultNative& Result);
+
+private:
+	/**
+	 * Transcode the encoded audio data into another format. Should be called from a background thread
+	 *
+	 * @param EncodedAudioInfoFrom The encoded audio data to transcode. May wrap a memory-mapped file region
+	 * @param EncodedFormatTo The desired format of the transcoded encoded audio data
+	 * @param Quality The quality of the transcoded encoded audio data
+	 * @param OverrideOptions The override options for the encoded audio data (fill with -1 if you don't want to override)
+	 * @param Result Delegate broadcasting the result
+	 */
+	static void TranscodeEncodedData_Internal(FEncodedAudioStruct&& EncodedAudioInfoFrom, ERuntimeAudioFormat EncodedFormatTo, uint8 Quality, const FRuntimeAudioExportOverrideOptions& OverrideOptions, const FOnEncodedDataTranscodeFromBufferResultNative& Result);
 };
@@ -21,6 +21,19 @@ DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnScanDirectoryForAudioFilesResult, bool, bS
 DECLARE_DELEGATE_TwoParams(FOnScanDirectoryForAudioFilesResultNative, bool, const TArray<FString>&);
 
 
+/** Dynamic delegate broadcasting the header information of the audio files scanned so far */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnScanDirectoryForAudioHeaderInfoProgress, const TArray<FRuntimeAudioFileHeaderInfo>&, FileHeaderInfos);
+
+/** Static delegate broadcasting the header information of the audio files scanned so far */
+DECLARE_DELEGATE_OneParam(FOnScanDirectoryForAudioHeaderInfoProgressNative, const TArray<FRuntimeAudioFileHeaderInfo>&);
+
+/** Dynamic delegate broadcasting the result of scanning directory for audio header information */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnScanDirectoryForAudioHeaderInfoResult, bool, bSucceeded, const TArray<FRuntimeAudioFileHeaderInfo>&, FileHeaderInfos);
+
+/** Static delegate broadcasting the result of scanning directory for audio header information */
+DECLARE_DELEGATE_TwoParams(FOnScanDirectoryForAudioHeaderInfoResultNative, bool, const TArray<FRuntimeAudioFileHeaderInfo>&);
+
+
 /**
  * Runtime Audio Utilities
  * Contains various functions for working with audio data, including retrieving audio header info, scanning directories for audio files, and more
@@ -125,4 +138,37 @@ public:
 	 * @param Result Delegate broadcasting the result
 	 */
 	static void ScanDirectoryForAudioFiles(const FString& Directory, bool bRecursive, const FOnScanDirectoryForAudioFilesResultNative& Result);
+
+	/**
+	 * Scan the specified directory for audio files and retrieve their header information in parallel
+	 * Only the parts of the files containing the header information are read where the format allows it, and the results are broadcast incrementally
+	 *
+	 * @param Directory The directory path to scan for audio files
+	 * @param bRecursive Whether to search for files recursively in subdirectories
+	 * @param Progress Delegate broadcasting the header information of each group of scanned files as soon as it is retrieved
+	 * @param Result Delegate broadcasting the header information of all scanned files
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Folder, Metadata"), Category = "Runtime Audio Utilities")
+	static void ScanDirectoryForAudioHeaderInfo(const FString& Directory, bool bRecursive, const FOnScanDirectoryForAudioHeaderInfoProgress& Progress, const FOnScanDirectoryForAudioHeaderInfoResult& Result);
+
+	/**
+	 * Scan the specified directory for audio files and retrieve their header information in parallel. Suitable for use in C++
+	 * Only the parts of the files containing the header information are read where the format allows it, and the results are broadcast incrementally
+	 *
+	 * @param Directory The directory path to scan for audio files
+	 * @param bRecursive Whether to search for files recursively in subdirectories
+	 * @param Progress Delegate broadcasting the header information of each group of scanned files as soon as it is retrieved
+	 * @param Result Delegate broadcasting the header information of all scanned files
+	 */
+	static void ScanDirectoryForAudioHeaderInfo(const FString& Directory, bool bRecursive, const FOnScanDirectoryForAudioHeaderInfoProgressNative& Progress, const FOnScanDirectoryForAudioHeaderInfoResultNative& Result);
+
+private:
+	/**
+	 * Retrieve audio header information from a file synchronously, reading only the header where the format allows it and falling back to loading the whole file otherwise
+	 *
+	 * @param FilePath The path to the audio file
+	 * @param HeaderInfo Retrieved header information
+	 * @return True if the header information was retrieved successfully
+	 */
+	static bool GetAudioHeaderInfoFromFile_Internal(const FString& FilePath, FRuntimeAudioHeaderInfo& HeaderInfo);
 };
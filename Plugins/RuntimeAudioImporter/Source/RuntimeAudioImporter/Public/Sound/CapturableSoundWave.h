@@ -87,7 +87,85 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Capturable Sound Wave|Info")
 	bool IsCapturing() const;
 
+	/**
+	 * Set the number of frames the capture device delivers per callback. Smaller values lower the latency at the cost of more frequent callbacks. 1024 by default
+	 * Takes effect the next time the capture is started
+	 *
+	 * @param NumOfFrames Number of frames per capture callback
+	 * @return Whether the frame size was set or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Capturable Sound Wave|Capture")
+	bool SetCaptureFrameSize(int32 NumOfFrames);
+
+	/**
+	 * Get the capture statistics, including the estimated capture-to-playback latency
+	 *
+	 * @return Capture statistics since the capture was started or the statistics were reset
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Capturable Sound Wave|Info")
+	FRuntimeAudioCaptureStats GetCaptureStats() const;
+
+	/**
+	 * Reset the capture statistics
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Capturable Sound Wave|Info")
+	void ResetCaptureStats();
+
 private:
+	/**
+	 * Buffer the captured audio data and append everything buffered so far to the sound wave, unless the sound wave is busy. Called in the capture thread
+	 * No memory is allocated once warmed up, unless the OnPopulateAudioData delegates are bound
+	 *
+	 * @param PCMData Captured interleaved 32-bit float PCM data
+	 * @param NumOfFrames Number of captured frames
+	 * @param NumOfChannels Number of channels of the capture device
+	 * @param InSampleRate Sample rate of the capture device
+	 * @param bOverflow Whether the capture device reported an overflow
+	 */
+	void ProcessCapturedAudioData(const float* PCMData, int32 NumOfFrames, int32 NumOfChannels, int32 InSampleRate, bool bOverflow);
+
+	/**
+	 * Grow CaptureRingBuffer to hold at least the given number of samples, keeping the buffered data
+	 * Should only be used by the thread using CaptureRingBuffer, i.e. the capture thread while the stream is open
+	 *
+	 * @param MinNumOfSamples Minimum number of samples CaptureRingBuffer should be able to hold
+	 */
+	void GrowCaptureRingBuffer(uint32 MinNumOfSamples);
+
+	/**
+	 * Append everything buffered in CaptureRingBuffer to the sound wave
+	 * Should only be used if DataGuard is locked, by the thread using CaptureRingBuffer
+	 *
+	 * @param AppendedPCMData Optional array to receive a copy of the PCM data as it was appended, for broadcasting
+	 * @return Whether any PCM data was appended or not
+	 */
+	bool AppendCaptureRingBuffer_Internal(TArray<float>* AppendedPCMData);
+
+	/** Number of frames the capture device delivers per callback */
+	int32 CaptureFrameSize = 1024;
+
+	/** Captured PCM data not yet appended to the sound wave. Filled and drained in the capture thread, so appending never waits for DataGuard */
+	FRuntimePCMRingBuffer CaptureRingBuffer;
+
+	/** PCM data drained from CaptureRingBuffer, reused between capture callbacks */
+	Audio::FAlignedFloatBuffer DrainedCapturePCMData;
+
+	/** Sample rate and number of channels of the data in CaptureRingBuffer, as delivered by the capture device. Written in the capture thread */
+	int32 CaptureSampleRate = 0;
+	int32 CaptureNumOfChannels = 0;
+
+	/** Capture statistics, except for the counters updated without DataGuard. Should only be used if DataGuard is locked */
+	FRuntimeAudioCaptureStats CaptureStats;
+
+	/** Number of captured frames dropped because CaptureRingBuffer was full */
+	std::atomic<int64> NumOfDroppedCaptureFrames{0};
+
+	/** Number of overflows reported by the capture device */
+	std::atomic<int32> NumOfCaptureOverflows{0};
+
+	/** Number of capture callbacks whose audio data did not fit into CaptureRingBuffer */
+	std::atomic<int32> NumOfCaptureBufferOverflows{0};
+
 #if WITH_RUNTIMEAUDIOIMPORTER_CAPTURE_SUPPORT
 #if PLATFORM_IOS && !PLATFORM_TVOS
 	/** Audio capture instance specific to iOS. Implemented manually due to the engine not properly supporting iOS audio capture at the moment */
@@ -36,6 +36,13 @@ DECLARE_DELEGATE_OneParam(FOnPlayedAudioDataReleaseResultNative, bool);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPlayedAudioDataReleaseResult, bool, bSucceeded);
 
 
+/** Static delegate broadcasting the result of resampling or mixing the channels of a sound wave */
+DECLARE_DELEGATE_OneParam(FOnSoundWaveConversionResultNative, bool);
+
+/** Dynamic delegate broadcasting the result of resampling or mixing the channels of a sound wave */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSoundWaveConversionResult, bool, bSucceeded);
+
+
 /** Static delegate broadcast newly populated PCM data */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPopulateAudioDataNative, const TArray<float>&);
 
@@ -115,8 +122,18 @@ public:
 	 */
 	virtual void PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&& DecodedAudioInfo);
 
+	/**
+	 * Populate audio data from PCM data shared with other sound waves (e.g. from the decoded audio cache) without copying it
+	 * The shared PCM data is never modified, the sound wave makes its own copy before the first modification instead
+	 *
+	 * @param SoundWaveBasicInfo Basic information about the PCM data
+	 * @param SharedPCMInfo Shared PCM data
+	 */
+	void PopulateAudioDataFromSharedPCM(const FSoundWaveBasicStruct& SoundWaveBasicInfo, TSharedPtr<FPCMStruct> SharedPCMInfo);
+
 	/**
 	 * Prepare this sound wave to be able to set wave parameter for MetaSounds
+	 * The PCM data is provided to MetaSounds as uncompressed 16-bit PCM, so no encoding pass is needed
 	 * 
 	 * @param Result Delegate broadcasting the result. Set the wave parameter only after it has been broadcast
 	 * @warning This works if bEnableMetaSoundSupport is enabled in RuntimeAudioImporter.Build.cs/RuntimeAudioImporterEditor.Build.cs and only on Unreal Engine version >= 5.2
@@ -140,7 +157,7 @@ public:
 
 	/**
 	 * Remove previously played audio data. Adds a duration offset from the removed audio data
-	 * This re-allocates all audio data memory, so should not be called too frequently
+	 * The remaining audio data is not copied, so this is cheap enough to be called frequently
 	 * 
 	 * @param Result Delegate broadcasting the result
 	 */
@@ -149,13 +166,24 @@ public:
 
 	/**
 	 * Remove previously played audio data. Adds a duration offset from the removed audio data
-	 * This re-allocates all audio data memory, so should not be called too frequently
+	 * The remaining audio data is not copied, so this is cheap enough to be called frequently
 	 * Suitable for use in C++
 	 *
 	 * @param Result Delegate broadcasting the result
 	 */
 	virtual void ReleasePlayedAudioData(const FOnPlayedAudioDataReleaseResultNative& Result);
 
+	/**
+	 * Set whether to automatically release played audio data whenever audio data is appended, keeping only the most recently played part of it
+	 * Useful for long-running streaming sound waves (e.g. voice chat), which would otherwise accumulate audio data indefinitely
+	 * Played audio data is not released while the sound wave is looping
+	 *
+	 * @param bEnable Whether to automatically release played audio data
+	 * @param KeepPlayedDuration Duration of the most recently played audio data to keep (e.g. to allow rewinding), in seconds
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Miscellaneous")
+	void SetAutoReleasePlayedAudioData(bool bEnable, float KeepPlayedDuration = 0);
+
 	/**
 	 * Set whether the sound should loop or not
 	 *
@@ -205,28 +233,63 @@ public:
 	 */
 	bool RewindPlaybackTime_Internal(float PlaybackTime);
 
-	// TODO: Make this async
 	/**
 	 * Resample the sound wave to the specified sample rate
+	 * The audio data is converted in blocks while the sound wave keeps playing the original audio data, which is replaced once the conversion is complete
+	 * Playback alone does not require resampling, since the audio mixer already resamples each sound to the output sample rate while rendering
 	 *
-	 * @note This is not thread-safe at the moment
 	 * @param NewSampleRate The new sample rate
 	 * @return Whether the sound wave was resampled or not
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Main")
 	bool ResampleSoundWave(int32 NewSampleRate);
 
-	// TODO: Make this async
+	/**
+	 * Resample the sound wave to the specified sample rate in a background thread, without blocking the calling thread or playback
+	 *
+	 * @param NewSampleRate The new sample rate
+	 * @param Result Delegate broadcasting the result
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Main")
+	void ResampleSoundWaveAsync(int32 NewSampleRate, const FOnSoundWaveConversionResult& Result);
+
+	/**
+	 * Resample the sound wave to the specified sample rate in a background thread, without blocking the calling thread or playback
+	 * Suitable for use in C++
+	 *
+	 * @param NewSampleRate The new sample rate
+	 * @param Result Delegate broadcasting the result
+	 */
+	void ResampleSoundWaveAsync(int32 NewSampleRate, const FOnSoundWaveConversionResultNative& Result);
+
 	/**
 	 * Change the number of channels of the sound wave
+	 * The audio data is converted in blocks while the sound wave keeps playing the original audio data, which is replaced once the conversion is complete
 	 *
-	 * @note This is not thread-safe at the moment
 	 * @param NewNumOfChannels The new number of channels
 	 * @return Whether the sound wave was mixed or not
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Main")
 	bool MixSoundWaveChannels(int32 NewNumOfChannels);
 
+	/**
+	 * Change the number of channels of the sound wave in a background thread, without blocking the calling thread or playback
+	 *
+	 * @param NewNumOfChannels The new number of channels
+	 * @param Result Delegate broadcasting the result
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Main")
+	void MixSoundWaveChannelsAsync(int32 NewNumOfChannels, const FOnSoundWaveConversionResult& Result);
+
+	/**
+	 * Change the number of channels of the sound wave in a background thread, without blocking the calling thread or playback
+	 * Suitable for use in C++
+	 *
+	 * @param NewNumOfChannels The new number of channels
+	 * @param Result Delegate broadcasting the result
+	 */
+	void MixSoundWaveChannelsAsync(int32 NewNumOfChannels, const FOnSoundWaveConversionResultNative& Result);
+
 	/**
 	 * Change the number of frames played back. Used to rewind the sound
 	 *
@@ -254,6 +317,12 @@ public:
 	 */
 	uint32 GetNumOfPlayedFrames_Internal() const;
 
+	/**
+	 * Get the number of frames actually handed to the audio renderer, i.e. the played frames excluding those still waiting in the render ring buffer
+	 * Should only be used if DataGuard is locked
+	 */
+	uint32 GetNumOfRenderedFrames_Internal() const;
+
 	/**
 	 * Get the current sound wave playback time, in seconds
 	 * @note This adds a duration offset (relevant if ReleasePlayedAudioData was used)
@@ -365,6 +434,57 @@ protected:
 	 */
 	void ResetPlaybackFinish();
 
+	/**
+	 * Stop sharing the PCM data populated by PopulateAudioDataFromSharedPCM, so it can be modified
+	 * Should only be used if DataGuard is locked
+	 *
+	 * @param bCopyPCMData Whether to copy the shared PCM data, or to start with empty PCM data because it is about to be replaced
+	 */
+	void DetachSharedPCMBuffer_Internal(bool bCopyPCMData);
+
+	/**
+	 * Convert the PCM data to the specified sample rate and number of channels
+	 * DataGuard is only locked to copy out one bounded block of the PCM data at a time and to replace the PCM data, so playback and appending continue meanwhile
+	 * The audio data appended during the conversion is converted as well, and the played audio data released during it is dropped from the converted PCM data
+	 *
+	 * @param NewSampleRate The new sample rate
+	 * @param NewNumOfChannels The new number of channels
+	 * @return Whether the PCM data was converted. Fails if the PCM data was replaced (e.g. populated again) or its format was changed during the conversion
+	 */
+	bool ConvertSoundWave_Internal(int32 NewSampleRate, int32 NewNumOfChannels);
+
+	/**
+	 * Remove the specified number of played frames from the start of the PCM data, adding their duration to the duration offset
+	 * Should only be used if DataGuard is locked
+	 *
+	 * @param NumOfFramesToRelease Number of played frames to remove. Clamped to the number of played frames
+	 */
+	void ReleasePlayedFrames_Internal(uint32 NumOfFramesToRelease);
+
+	/**
+	 * Release played audio data according to the policy set by SetAutoReleasePlayedAudioData
+	 * Should only be used if DataGuard is locked
+	 */
+	void AutoReleasePlayedAudioData_Internal();
+
+	/**
+	 * Move upcoming PCM data into the render ring buffer, counting it as played
+	 * Should only be used if DataGuard is locked
+	 */
+	void FillPCMRingBuffer_Internal();
+
+	/**
+	 * Make the render thread discard the PCM data already in the render ring buffer, e.g. after the playback position or the PCM data has changed
+	 * The discarded frames have not been heard, so the number of played frames returns to the number of rendered frames
+	 * Should be called before changing the number of channels or the number of played frames. Should only be used if DataGuard is locked
+	 */
+	void RequestPCMRingBufferFlush_Internal();
+
+	/**
+	 * Broadcast the PCM data generated since the previous broadcast to OnGeneratePCMDataNative and OnGeneratePCMData. Called in the game thread
+	 */
+	void BroadcastGeneratedPCMData();
+
 public:
 	/** Bind to this delegate to know when the audio playback is finished. Suitable for use in C++ */
 	FOnAudioPlaybackFinishedNative OnAudioPlaybackFinishedNative;
@@ -383,6 +503,18 @@ public:
 protected:
 	/** Data guard (mutex) for thread safety */
 	mutable FCriticalSection OnGeneratePCMData_DataGuard;
+
+	/** PCM data generated during playback since the previous OnGeneratePCMData broadcast. Appended to in the audio render thread */
+	TArray<float> PendingGeneratedPCMData;
+
+	/** PCM data being broadcast to OnGeneratePCMData. Swapped with PendingGeneratedPCMData in the game thread, so both keep their allocations */
+	TArray<float> BroadcastingGeneratedPCMData;
+
+	/** Data guard (mutex) for PendingGeneratedPCMData. Held only while appending or swapping */
+	FCriticalSection PendingGeneratedPCMData_DataGuard;
+
+	/** Whether a broadcast of the generated PCM data has already been scheduled in the game thread */
+	std::atomic<bool> bGeneratedPCMDataBroadcastScheduled;
 	
 public:
 	/** Bind to this delegate to obtain audio data every time it is populated. Suitable for use in C++ */
@@ -443,9 +575,36 @@ protected:
 	/** Contains PCM data for sound wave playback */
 	TSharedPtr<FPCMStruct> PCMBufferInfo;
 
+	/** Whether to automatically release played audio data whenever audio data is appended (see SetAutoReleasePlayedAudioData) */
+	bool bAutoReleasePlayedAudioData;
+
+	/** Duration of the most recently played audio data kept by the automatic release, in seconds */
+	float AutoReleaseKeepPlayedDuration;
+
+	/** Whether PCMBufferInfo is shared via PopulateAudioDataFromSharedPCM and must be detached before being modified */
+	bool bSharedPCMBuffer;
+
+	/** Total number of played frames released from the start of the PCM data. Lets a conversion in progress keep track of its position in the PCM data */
+	uint64 NumOfReleasedFrames;
+
+	/** Incremented whenever the PCM data is replaced rather than appended to or released, so a conversion in progress can tell its PCM data is gone */
+	uint32 PCMDataRevision;
+
+	/** PCM data prefetched for the audio render thread, which reads it without locking DataGuard. Frames are counted as played once they are pushed here (see GetNumOfRenderedFrames_Internal) */
+	FRuntimePCMRingBuffer PCMRingBuffer;
+
+	/** Whether the render thread should discard the PCM data currently in PCMRingBuffer */
+	std::atomic<bool> bPCMRingBufferFlushRequested;
+
+	/** Number of samples requested by the most recent render callback. Used to size the prefetch */
+	std::atomic<int32> LastRequestedNumOfSamples;
+
 	/** Whether to stop the sound at the end of playback or not. Sound wave will not be garbage collected if playback was completed while this parameter is set to false */
 	bool bStopSoundOnPlaybackFinish;
 
 	/** Audio format of the audio imported into the sound wave */
 	ERuntimeAudioFormat ImportedAudioFormat;
+
+	/** Runtime format of the audio resource initialized for MetaSounds (see InitAudioResource). None if it has not been initialized yet */
+	FName MetaSoundsAudioResourceFormat;
 };
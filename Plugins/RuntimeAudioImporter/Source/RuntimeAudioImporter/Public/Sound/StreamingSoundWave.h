@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "ImportedSoundWave.h"
+#include "Codecs/RAW_RuntimeCodec.h"
 #include "Delegates/Delegate.h"
 #include "Containers/Queue.h"
 #include "StreamingSoundWave.generated.h"
@@ -17,7 +18,7 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPreAllocateAudioDataResult, bool, bSucceede
 /**
  * Streaming sound wave. Can append audio data dynamically, including during playback
  * It will live indefinitely, even if the sound wave has finished playing, until SetStopSoundOnPlaybackFinish is called.
- * Audio data is always accumulated, clear memory manually via ReleaseMemory or ReleasePlayedAudioData if necessary.
+ * Audio data is accumulated by default, clear memory manually via ReleaseMemory or ReleasePlayedAudioData if necessary, or automatically via SetAutoReleasePlayedAudioData.
  */
 UCLASS(BlueprintType, Category = "Streaming Sound Wave")
 class RUNTIMEAUDIOIMPORTER_API UStreamingSoundWave : public UImportedSoundWave
@@ -36,7 +37,8 @@ public:
 	static UStreamingSoundWave* CreateStreamingSoundWave();
 
 	/**
-	 * Pre-allocate PCM data, to avoid reallocating memory each time audio data is appended
+	 * Pre-allocate PCM data, to avoid reallocating memory while the appended audio data fits in
+	 * Not required for performance, since the PCM data capacity grows geometrically when audio data is appended
 	 *
 	 * @param NumOfBytesToPreAllocate Number of bytes to pre-allocate
 	 * @param Result Delegate broadcasting the result
@@ -79,10 +81,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Imported Streaming Sound Wave|Import")
 	void SetStopSoundOnPlaybackFinish(bool bStop);
 
+	/**
+	 * Set the quality used to resample appended audio data whose sample rate differs from the sound wave's one. BestSinc by default
+	 * Changing the quality restarts the resampler, so it is best done before appending audio data
+	 *
+	 * @param Quality Resampling quality
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Streaming Sound Wave|Append")
+	void SetResamplingQuality(ERuntimeResamplingQuality Quality);
+
+	/**
+	 * Finish the resampled stream of appended audio data, appending the last frames held back by the resampler
+	 * Only needed if the appended audio data is resampled, since the resampler holds back a few frames to filter them together with the next appended audio data
+	 * Audio data appended afterwards starts a new stream
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Streaming Sound Wave|Append")
+	void FinishAppendingAudioData();
+
+	/**
+	 * Append decoded PCM data right away in the calling thread, bypassing the queue of appended audio data. Suitable for use in C++ by a single producer appending its data in order, such as a streamed import
+	 *
+	 * @param PCMData Interleaved 32-bit float PCM data
+	 * @param NumOfSamples Number of samples in PCMData
+	 * @param InSampleRate Sample rate of PCMData
+	 * @param InNumOfChannels Number of channels in PCMData
+	 * @param bEndOfStream Whether this is the last PCM data of the stream, in which case the frames held back by the resampler are appended as well
+	 * @return Whether the PCM data was appended or not
+	 */
+	bool AppendPCMData(const float* PCMData, int64 NumOfSamples, int32 InSampleRate, int32 InNumOfChannels, bool bEndOfStream = false);
+
 	//~ Begin UImportedSoundWave Interface
 	virtual void PopulateAudioDataFromDecodedInfo(FDecodedAudioStruct&& DecodedAudioInfo) override;
-	virtual void ReleaseMemory() override;
-	virtual void ReleasePlayedAudioData(const FOnPlayedAudioDataReleaseResultNative& Result) override;
 	//~ End UImportedSoundWave Interface
 
 protected:
@@ -92,10 +121,63 @@ protected:
 	/** Queue of audio data to be appended. Needed to maintain the consecutive order of audio data when appending */
 	TQueue<FAudioTaskDelegate> AppendAudioTaskQueue;
 
+	/**
+	 * Append PCM data to the end of existing data, converting it to the sound wave's sample rate and number of channels if needed
+	 * Should only be used if DataGuard is locked
+	 *
+	 * @param PCMData Interleaved 32-bit float PCM data
+	 * @param NumOfSamples Number of samples in PCMData
+	 * @param InSampleRate Sample rate of PCMData
+	 * @param InNumOfChannels Number of channels in PCMData
+	 * @param AppendedPCMData Optional array to receive a copy of the PCM data as it was appended, for broadcasting
+	 * @param bEndOfStream Whether this is the last PCM data of the stream, in which case the frames held back by the resampler are appended as well
+	 * @return Whether the PCM data was appended or not
+	 */
+	bool AppendPCMData_Internal(const float* PCMData, int64 NumOfSamples, int32 InSampleRate, int32 InNumOfChannels, TArray<float>* AppendedPCMData = nullptr, bool bEndOfStream = false);
+
+	/**
+	 * Flush the frames held back by the resampler and append them to the end of existing data
+	 * Should only be used if DataGuard is locked, which is held across both steps so the render thread never observes the resampler flushed without the frames appended
+	 *
+	 * @param AppendedPCMData Optional array to receive a copy of the PCM data as it was appended, for broadcasting
+	 * @return Whether the held back frames were appended or not
+	 */
+	bool FlushResampledPCMData_Internal(TArray<float>* AppendedPCMData = nullptr);
+
+	/**
+	 * Append PCM data that is already in the sound wave's sample rate and number of channels
+	 * Should only be used if DataGuard is locked
+	 *
+	 * @param PCMData Interleaved 32-bit float PCM data
+	 * @param NumOfSamples Number of samples in PCMData
+	 * @param AppendedPCMData Optional array to receive a copy of the PCM data as it was appended, for broadcasting
+	 * @return Whether the PCM data was appended or not
+	 */
+	bool AppendConvertedPCMData_Internal(const float* PCMData, int64 NumOfSamples, TArray<float>* AppendedPCMData);
+
+	/**
+	 * Check whether OnPopulateAudioDataNative or OnPopulateAudioData are bound, i.e. whether the appended PCM data needs to be copied for broadcasting
+	 */
+	bool IsPopulateAudioDataBound() const;
+
+	/**
+	 * Broadcast the OnPopulateAudioData and OnPopulateAudioState delegates in the game thread
+	 * Should not be used if DataGuard is locked, since the delegates are broadcast under OnPopulateAudioData_DataGuard
+	 *
+	 * @param AppendedPCMData PCM data that was appended. Not broadcast if empty
+	 */
+	void BroadcastPopulatedAudioData(TArray<float>&& AppendedPCMData);
+
 private:
 	/** Whether the initial audio data is filled in or not */
 	bool bFilledInitialAudioData;
 
-	/** Number of pre-allocated byte data for PCM */
-	int64 NumOfPreAllocatedByteData;
+	/** Quality used to resample appended audio data */
+	ERuntimeResamplingQuality ResamplingQuality;
+
+	/** Resampler and channel mixer for appended audio data, keeping its state between appends. Should only be used if DataGuard is locked */
+	FRuntimeStreamingResampler StreamingResampler;
+
+	/** Converted PCM data of the latest append, reused between appends. Should only be used if DataGuard is locked */
+	Audio::FAlignedFloatBuffer ConvertedPCMData;
 };
@@ -21,9 +21,11 @@ public class RuntimeAudioImporter : ModuleRules
 
 		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
 
+		// VorbisFile provides the ov_* functions used to decode Vorbis straight to float
 		AddEngineThirdPartyPrivateStaticDependencies(Target,
 			"UEOgg",
-			"Vorbis"
+			"Vorbis",
+			"VorbisFile"
 		);
 		
 		// This is necessary because the Vorbis module does not include the Unix-specific libvorbis encoder library
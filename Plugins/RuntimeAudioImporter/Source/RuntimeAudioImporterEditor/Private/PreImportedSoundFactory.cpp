@@ -50,9 +50,9 @@ UObject* UPreImportedSoundFactory::FactoryCreateFile(UClass* InClass, UObject* I
 	FRuntimeBulkDataBuffer<uint8> BulkDataBuffer(AudioData);
 
 	FRuntimeCodecFactory CodecFactory;
-	TUniquePtr<FBaseRuntimeCodec> RuntimeCodec = CodecFactory.GetCodec(BulkDataBuffer);
+	FBaseRuntimeCodec* RuntimeCodec = CodecFactory.GetCodec(BulkDataBuffer);
 
-	if (!RuntimeCodec.IsValid())
+	if (!RuntimeCodec)
 	{
 		FMessageLog("Import").Error(FText::Format(LOCTEXT("PreImportedSoundFactory_CodecError", "Unable to determine the audio codec for the file '{0}'. Make sure the file is not corrupted'"), FText::FromString(Filename)));
 		return nullptr;
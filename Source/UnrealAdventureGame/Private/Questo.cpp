@@ -0,0 +1,9 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Questo.h"
+
+DEFINE_LOG_CATEGORY(LogQuesto);
+
+DEFINE_STAT(STAT_QuestoLookups);
+DEFINE_STAT(STAT_QuestoLookupMisses);
+DEFINE_STAT(STAT_QuestoCreations);
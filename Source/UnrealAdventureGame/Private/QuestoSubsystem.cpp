@@ -1,5 +1,10 @@
 #include "QuestoSubsystem.h"
 
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+
 UQuestoSubsystem::UQuestoSubsystem()
 : UEngineSubsystem()
 {
@@ -21,33 +26,49 @@ void UQuestoSubsystem::Deinitialize()
 	Super::Deinitialize();
 }
 
-bool UQuestoSubsystem::GetOrCreateQuest(const FString& QuestName, UPARAM(ref) UUnrealQuest*& OutUnrealQuest)
+QuestSystem& UQuestoSubsystem::GetQuestSystem()
 {
-	// Convert FString to std::string
-	std::string QuestNameString(TCHAR_TO_UTF8(*QuestName));
-	
+	return mQuestSystem;
+}
+
+void UQuestoSubsystem::SetConcurrentAccessEnabled(bool bEnabled)
+{
+	mQuestSystem.setConcurrentAccess(bEnabled);
+}
+
+UUnrealQuest* UQuestoSubsystem::GetQuestWrapper(size_t QuestIndex)
+{
+	FScopeLock Lock(&mQuestWrappersGuard);
 	
-	// Check if the quest was created successfully
-	if (mQuestSystem.createEmptyQuest(QuestNameString))
+	if (QuestIndex >= static_cast<size_t>(mQuestWrappers.Num()))
 	{
-		UUnrealQuest* NewQuest = NewObject<UUnrealQuest>(this);
-		
-		NewQuest->Initialize(mQuestSystem.getQuest(QuestNameString).value());
-
-		NewQuest->Name = QuestName;
-		OutUnrealQuest = NewQuest;
+		mQuestWrappers.SetNumZeroed(QuestIndex + 1);
 	}
-	else
+	
+	UUnrealQuest*& QuestWrapper = mQuestWrappers[QuestIndex];
+	if (QuestWrapper == nullptr)
 	{
-		UUnrealQuest* NewQuest = NewObject<UUnrealQuest>(this);
-		
-		NewQuest->Initialize(mQuestSystem.getQuest(QuestNameString).value());
-		
-		NewQuest->Name = QuestName;
-		OutUnrealQuest = NewQuest;
-
+		QuestWrapper = NewObject<UUnrealQuest>(this);
+		QuestWrapper->Initialize(mQuestSystem, QuestIndex);
+		QuestWrapper->Name = UTF8_TO_TCHAR(mQuestSystem.getQuestAt(QuestIndex).getName().c_str());
 	}
 	
+	return QuestWrapper;
+}
+
+bool UQuestoSubsystem::GetOrCreateQuest(const FString& QuestName, UPARAM(ref) UUnrealQuest*& OutUnrealQuest)
+{
+	QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+	
+	// Convert FString to std::string
+	std::string QuestNameString(TCHAR_TO_UTF8(*QuestName));
+	
+	
+	// Creating is a no-op if the quest already exists
+	mQuestSystem.createEmptyQuest(QuestNameString);
+	
+	OutUnrealQuest = GetQuestWrapper(*mQuestSystem.findQuestIndex(QuestNameString));
+	
 	// Returning false to indicate failure
 	return true;
 
@@ -55,25 +76,22 @@ bool UQuestoSubsystem::GetOrCreateQuest(const FString& QuestName, UPARAM(ref) UU
 
 bool UQuestoSubsystem::GetQuest(const FString& QuestName, UPARAM(ref) UUnrealQuest*& OutUnrealQuest)
 {
+	QuestSystem::ReadLock Lock = mQuestSystem.readLock();
+	
 	// Convert FString to std::string
 	std::string QuestNameString(TCHAR_TO_UTF8(*QuestName));
 	
 	// Check if the quest was created successfully
-	if (mQuestSystem.findQuest(QuestNameString))
+	if (std::optional<size_t> QuestIndex = mQuestSystem.findQuestIndex(QuestNameString))
 	{
-		UUnrealQuest* NewQuest = NewObject<UUnrealQuest>(this);
-		
-		NewQuest->Initialize(mQuestSystem.getQuest(QuestNameString).value());
-		
-		NewQuest->Name = QuestName;
-		OutUnrealQuest = NewQuest;
+		OutUnrealQuest = GetQuestWrapper(*QuestIndex);
 		
 		return true;
 	}
 	else
 	{
 		// Log an error or handle the failure in some way
-		UE_LOG(LogTemp, Error, TEXT("quest does not exist for %s."), *QuestName);
+		UE_LOG(LogQuesto, Error, TEXT("quest does not exist for %s."), *QuestName);
 		
 		// Returning false to indicate failure
 		return false;
@@ -82,29 +100,54 @@ bool UQuestoSubsystem::GetQuest(const FString& QuestName, UPARAM(ref) UUnrealQue
 
 bool UQuestoSubsystem::GetActiveQuest(UPARAM(ref) UUnrealQuest*& OutUnrealQuest)
 {
+	QuestSystem::ReadLock Lock = mQuestSystem.readLock();
+	
 	// Check if the quest was created successfully
-	if (mQuestSystem.getActiveQuest() != std::nullopt)
+	if (std::optional<size_t> QuestIndex = mQuestSystem.getActiveQuestIndex())
 	{
-		UUnrealQuest* NewQuest = NewObject<UUnrealQuest>(this);
-		
-		NewQuest->Initialize(*mQuestSystem.getActiveQuest());
-		
-		OutUnrealQuest = NewQuest;
+		OutUnrealQuest = GetQuestWrapper(*QuestIndex);
 		
 		return true;
 	}
 	else
 	{
 		// Log an error or handle the failure in some way
-		UE_LOG(LogTemp, Error, TEXT("quest does not exist."));
+		UE_LOG(LogQuesto, Error, TEXT("quest does not exist."));
 		
 		// Returning false to indicate failure
 		return false;
 	}
 }
 
+bool UQuestoSubsystem::GetActiveSubStage(UPARAM(ref) UUnrealSubStage*& OutUnrealSubStage)
+{
+	// The whole chain is resolved under one read lock, so a concurrent SetActiveQuest cannot mix the sub-stage of one quest
+	// with the stage of another
+	QuestSystem::ReadLock Lock = mQuestSystem.readLock();
+	
+	if (std::optional<size_t> QuestIndex = mQuestSystem.getActiveQuestIndex())
+	{
+		Quest& ActiveQuest = mQuestSystem.getQuestAt(*QuestIndex);
+		if (std::optional<size_t> StageIndex = ActiveQuest.getActiveStageIndex())
+		{
+			Stage& ActiveStage = ActiveQuest.getStageAt(*StageIndex);
+			if (std::optional<size_t> SubStageIndex = ActiveStage.getActiveSubStageIndex())
+			{
+				UUnrealStage* StageWrapper = GetQuestWrapper(*QuestIndex)->GetStageWrapper(ActiveQuest, *StageIndex);
+				OutUnrealSubStage = StageWrapper->GetSubStageWrapper(ActiveStage, *SubStageIndex);
+				return true;
+			}
+		}
+	}
+	
+	UE_LOG(LogQuesto, Error, TEXT("Failed to retrieve the active sub-stage."));
+	return false;
+}
+
 void UQuestoSubsystem::SetActiveQuest(const FString& QuestName)
 {
+	QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+	
 	// Convert FString to std::string
 	std::string QuestNameString(TCHAR_TO_UTF8(*QuestName));
 	
@@ -114,27 +157,43 @@ void UQuestoSubsystem::SetActiveQuest(const FString& QuestName)
 
 void UQuestoSubsystem::SetDialogForCharacter(const FString& Id, const FString& Content)
 {
+	QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+	
 	std::string IdString(TCHAR_TO_UTF8(*Id));
 	std::string ContentString(TCHAR_TO_UTF8(*Content));
 	
 	
+	SubStage* ActiveSubStage = mQuestSystem.getActiveSubStage();
+	if (ActiveSubStage == nullptr)
+	{
+		UE_LOG(LogQuesto, Error, TEXT("No active sub-stage to set the dialog for character %s."), *Id);
+		return;
+	}
+	
 	Dialog* dialog = nullptr;
 	
-	mQuestSystem.getActiveQuest()->get().getActiveStage()->get().getActiveSubStage()->get().getDialog(IdString, &dialog);
+	ActiveSubStage->getDialog(IdString, &dialog);
 	
 	dialog->setString(ContentString);
 }
 
 void UQuestoSubsystem::ClearGibberishForCharacter(const FString& Id)
 {
+	QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+	
 	std::string IdString(TCHAR_TO_UTF8(*Id));
 	
-	mQuestSystem.getActiveQuest()->get().getActiveStage()->get().getActiveSubStage()->get().clearGibberishForCharacter(IdString);
+	if (SubStage* ActiveSubStage = mQuestSystem.getActiveSubStage())
+	{
+		ActiveSubStage->clearGibberishForCharacter(IdString);
+	}
 }
 
 
 void UQuestoSubsystem::AppendGibberishForCharacter(const FString& character, const FString& id, const TArray<uint8>& gibberish)
 {
+	QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+	
 	std::string CharacterString(TCHAR_TO_UTF8(*character));
 	std::string IdString(TCHAR_TO_UTF8(*id));
 	
@@ -142,29 +201,111 @@ void UQuestoSubsystem::AppendGibberishForCharacter(const FString& character, con
 	stdVector.assign(gibberish.GetData(), gibberish.GetData() + gibberish.Num());
 	
 	
-	mQuestSystem.getActiveQuest()->get().getActiveStage()->get().getActiveSubStage()->get().appendGibberishForCharacter(CharacterString, IdString, stdVector);
+	if (SubStage* ActiveSubStage = mQuestSystem.getActiveSubStage())
+	{
+		ActiveSubStage->appendGibberishForCharacter(CharacterString, IdString, stdVector);
+	}
 	
 }
 
 
 bool UQuestoSubsystem::GetDialogForCharacter(const FString& Id, UPARAM(ref) UUnrealDialog*& OutUnrealDialog)
 {
-	std::string DialogIdString(TCHAR_TO_UTF8(*Id));
+	// Walk the cached wrappers so the same dialog object is handed back every time
+	UUnrealSubStage* ActiveSubStage = nullptr;
 	
-	Dialog* dialog = nullptr;
-	
-	if(mQuestSystem.getActiveQuest()->get().getActiveStage()->get().getActiveSubStage()->get().getDialog(DialogIdString, &dialog)){
-		UUnrealDialog* NewDialog = NewObject<UUnrealDialog>(this);
-		
-		NewDialog->Initialize(*dialog);
-		NewDialog->CharacterId = Id;
-		OutUnrealDialog = NewDialog;
-		
+	if (GetActiveSubStage(ActiveSubStage) && ActiveSubStage->GetDialogForCharacter(Id, OutUnrealDialog)) {
 		return true;
 		
 	} else {
-		UE_LOG(LogTemp, Error, TEXT("Failed to retrieve dialog for character %s."), *Id);
+		UE_LOG(LogQuesto, Error, TEXT("Failed to retrieve dialog for character %s."), *Id);
 		
 		return false;
 	}
 }
+
+bool UQuestoSubsystem::SaveSnapshotToBuffer(TArray<uint8>& OutSnapshot) const
+{
+	QuestSystem::ReadLock Lock = mQuestSystem.readLock();
+	
+	std::vector<unsigned char> snapshot;
+	mQuestSystem.saveSnapshot(snapshot);
+	
+	OutSnapshot.SetNumUninitialized(snapshot.size());
+	FMemory::Memcpy(OutSnapshot.GetData(), snapshot.data(), snapshot.size());
+	
+	return true;
+}
+
+bool UQuestoSubsystem::LoadSnapshotFromBuffer(const TArray<uint8>& Snapshot)
+{
+	QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+	
+	if (!mQuestSystem.loadSnapshot(Snapshot.GetData(), Snapshot.Num()))
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Failed to load quest snapshot from buffer."));
+		return false;
+	}
+	
+	// Wrappers handed out before the load now resolve to nothing, new queries get fresh ones
+	mQuestWrappers.Reset();
+	return true;
+}
+
+bool UQuestoSubsystem::SaveSnapshotToFile(const FString& FilePath) const
+{
+	std::vector<unsigned char> snapshot;
+	{
+		QuestSystem::ReadLock Lock = mQuestSystem.readLock();
+		mQuestSystem.saveSnapshot(snapshot);
+	}
+	
+	if (!FFileHelper::SaveArrayToFile(TArrayView<const uint8>(snapshot.data(), snapshot.size()), *FilePath))
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Failed to save quest snapshot to %s."), *FilePath);
+		return false;
+	}
+	
+	return true;
+}
+
+bool UQuestoSubsystem::LoadSnapshotFromFile(const FString& FilePath)
+{
+	// Try to map the file first so the snapshot is parsed straight from the page cache
+	TUniquePtr<IMappedFileHandle> MappedFileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if (MappedFileHandle.IsValid() && MappedFileHandle->GetFileSize() > 0)
+	{
+		TUniquePtr<IMappedFileRegion> MappedFileRegion(MappedFileHandle->MapRegion());
+		if (MappedFileRegion.IsValid())
+		{
+			QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+			
+			if (!mQuestSystem.loadSnapshot(MappedFileRegion->GetMappedPtr(), MappedFileRegion->GetMappedSize()))
+			{
+				UE_LOG(LogQuesto, Error, TEXT("Failed to load quest snapshot from %s."), *FilePath);
+				return false;
+			}
+			
+			mQuestWrappers.Reset();
+			return true;
+		}
+	}
+	
+	TArray64<uint8> Snapshot;
+	if (!FFileHelper::LoadFileToArray(Snapshot, *FilePath))
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Failed to read quest snapshot file %s."), *FilePath);
+		return false;
+	}
+	
+	QuestSystem::WriteLock Lock = mQuestSystem.writeLock();
+	
+	if (!mQuestSystem.loadSnapshot(Snapshot.GetData(), Snapshot.Num()))
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Failed to load quest snapshot from %s."), *FilePath);
+		return false;
+	}
+	
+	mQuestWrappers.Reset();
+	return true;
+}
@@ -1,5 +1,7 @@
 #include "UnrealDialog.h"
 
+#include "UnrealSubStage.h"
+
 UUnrealDialog::UUnrealDialog()
 {
 	// Default constructor implementation
@@ -13,23 +15,91 @@ UUnrealDialog::UUnrealDialog(const FObjectInitializer& ObjectInitializer)
 	// Make sure to initialize any variables here if needed
 }
 
-void UUnrealDialog::Initialize(Dialog& dialog)
+void UUnrealDialog::Initialize(UUnrealSubStage* ownerSubStage, const FString& characterId)
+{
+	mOwnerSubStage = ownerSubStage;
+	mCharacterId = TCHAR_TO_UTF8(*characterId);
+	CharacterId = characterId;
+}
+
+Dialog* UUnrealDialog::ResolveDialog() const
+{
+	SubStage* subStage = mOwnerSubStage != nullptr ? mOwnerSubStage->ResolveSubStage() : nullptr;
+	if (subStage == nullptr)
+	{
+		return nullptr;
+	}
+	
+	return subStage->findDialog(mCharacterId);
+}
+
+QuestSystem* UUnrealDialog::GetQuestSystem() const
 {
-	mDialog = &dialog;
+	return mOwnerSubStage != nullptr ? mOwnerSubStage->GetQuestSystem() : nullptr;
 }
 
 FString UUnrealDialog::GetString(){
-	return FString(UTF8_TO_TCHAR(mDialog->getString().c_str()));
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	Dialog* dialog = ResolveDialog();
+	if (dialog == nullptr)
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Dialog for character %s is no longer valid."), *CharacterId);
+		return FString();
+	}
+	
+	return FString(UTF8_TO_TCHAR(dialog->getString().c_str()));
 }
 
 TArray<uint8> UUnrealDialog::GetGibberish(){
-	const std::vector<unsigned char>& gibberishVector = mDialog->getGibberish();
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	// Blueprint needs an owning array, so this is the only copy of the clip
+	return TArray<uint8>(FindGibberishView(INDEX_NONE));
+}
+
+int32 UUnrealDialog::GetGibberishCount(){
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	Dialog* dialog = ResolveDialog();
+	
+	return dialog != nullptr ? static_cast<int32>(dialog->getGibberishCount()) : 0;
+}
+
+TArray<uint8> UUnrealDialog::GetGibberishAt(int32 Index){
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	return TArray<uint8>(FindGibberishView(Index));
+}
+
+TArrayView<const uint8> UUnrealDialog::GetGibberishView(){
+	return FindGibberishView(INDEX_NONE);
+}
+
+TArrayView<const uint8> UUnrealDialog::GetGibberishViewAt(int32 Index){
+	return FindGibberishView(Index);
+}
+
+TArrayView<const uint8> UUnrealDialog::FindGibberishView(int32 Index){
+	Dialog* dialog = ResolveDialog();
+	if (dialog == nullptr)
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Dialog for character %s is no longer valid."), *CharacterId);
+		return TArrayView<const uint8>();
+	}
 	
-	// Convert the std::vector to TArray<uint8>
-	TArray<uint8> gibberishArray;
-	gibberishArray.SetNumUninitialized(gibberishVector.size());
+	if (Index == INDEX_NONE)
+	{
+		Dialog::GibberishView view = dialog->getRandomGibberishView();
+		return TArrayView<const uint8>(view.data, static_cast<int32>(view.size));
+	}
 	
-	FMemory::Memcpy(gibberishArray.GetData(), gibberishVector.data(), gibberishVector.size());
+	if (Index < 0 || static_cast<size_t>(Index) >= dialog->getGibberishCount())
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Gibberish index %d is out of range for character %s."), Index, *CharacterId);
+		return TArrayView<const uint8>();
+	}
 	
-	return gibberishArray;
+	Dialog::GibberishView view = dialog->getGibberishView(static_cast<size_t>(Index));
+	return TArrayView<const uint8>(view.data, static_cast<int32>(view.size));
 }
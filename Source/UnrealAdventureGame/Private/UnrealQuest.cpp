@@ -2,6 +2,8 @@
 
 #include "UnrealQuest.h"
 
+#include "Misc/ScopeLock.h"
+
 UUnrealQuest::UUnrealQuest()
 {
 	// Default constructor implementation
@@ -15,60 +17,98 @@ UUnrealQuest::UUnrealQuest(const FObjectInitializer& ObjectInitializer)
 	// Make sure to initialize any variables here if needed
 }
 
-void UUnrealQuest::Initialize(Quest& quest)
+void UUnrealQuest::Initialize(QuestSystem& questSystem, size_t questIndex)
 {
-	mQuest = &quest;
+	mQuestSystem = &questSystem;
+	mQuestIndex = questIndex;
+	mGeneration = questSystem.getGeneration();
+	mStageWrappers.Reset();
 }
 
+Quest* UUnrealQuest::ResolveQuest() const
+{
+	if (mQuestSystem == nullptr || mQuestSystem->getGeneration() != mGeneration || mQuestIndex >= mQuestSystem->getQuestCount())
+	{
+		return nullptr;
+	}
+	
+	return &mQuestSystem->getQuestAt(mQuestIndex);
+}
 
-bool UUnrealQuest::GetOrCreateStage(const FString& StageName, UPARAM(ref) UUnrealStage*& OutUnrealStage)
+QuestSystem* UUnrealQuest::GetQuestSystem() const
 {
-	// Convert FString to std::string
-	std::string StageNameString(TCHAR_TO_UTF8(*StageName));
+	return mQuestSystem;
+}
+
+UUnrealStage* UUnrealQuest::GetStageWrapper(Quest& quest, size_t StageIndex)
+{
+	FScopeLock WrappersLock(&mStageWrappersGuard);
 	
+	if (StageIndex >= static_cast<size_t>(mStageWrappers.Num()))
+	{
+		mStageWrappers.SetNumZeroed(StageIndex + 1);
+	}
 	
-	// Check if the quest was created successfully
-	if (mQuest->createEmptyStage(StageNameString))
+	UUnrealStage*& StageWrapper = mStageWrappers[StageIndex];
+	if (StageWrapper == nullptr)
 	{
-		UUnrealStage* NewStage = NewObject<UUnrealStage>(this);
-		
-		NewStage->Initialize(*mQuest->getStage(StageNameString));
-		NewStage->Name = StageName;
-		OutUnrealStage = NewStage;
+		StageWrapper = NewObject<UUnrealStage>(this);
+		StageWrapper->Initialize(this, StageIndex);
+		StageWrapper->Name = UTF8_TO_TCHAR(quest.getStageAt(StageIndex).getName().c_str());
 	}
-	else
+	
+	return StageWrapper;
+}
+
+
+bool UUnrealQuest::GetOrCreateStage(const FString& StageName, UPARAM(ref) UUnrealStage*& OutUnrealStage)
+{
+	QuestSystem::WriteLock Lock = QuestoUtil::writeLock(GetQuestSystem());
+	
+	Quest* quest = ResolveQuest();
+	if (quest == nullptr)
 	{
-		UUnrealStage* NewStage = NewObject<UUnrealStage>(this);
-		
-		NewStage->Initialize(*mQuest->getStage(StageNameString));
-		NewStage->Name = StageName;
-		OutUnrealStage = NewStage;
+		UE_LOG(LogQuesto, Error, TEXT("Quest %s is no longer valid."), *Name);
+		return false;
 	}
+	
+	// Convert FString to std::string
+	std::string StageNameString(TCHAR_TO_UTF8(*StageName));
+	
+	// Creating is a no-op if the stage already exists
+	quest->createEmptyStage(StageNameString);
+	
+	OutUnrealStage = GetStageWrapper(*quest, *quest->findStageIndex(StageNameString));
 	return true;
 
 }
 
 bool UUnrealQuest::GetStage(const FString& StageName, UPARAM(ref) UUnrealStage*& OutUnrealStage)
 {
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	Quest* quest = ResolveQuest();
+	if (quest == nullptr)
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Quest %s is no longer valid."), *Name);
+		return false;
+	}
+	
 	// Convert FString to std::string
 	std::string StageNameString(TCHAR_TO_UTF8(*StageName));
 	
 	
 	// Check if the quest was created successfully
-	if (mQuest->findStage(StageNameString))
+	if (std::optional<size_t> StageIndex = quest->findStageIndex(StageNameString))
 	{
-		UUnrealStage* NewStage = NewObject<UUnrealStage>(this);
-		
-		NewStage->Initialize(*mQuest->getStage(StageNameString));
-		NewStage->Name = StageName;
-		OutUnrealStage = NewStage;
+		OutUnrealStage = GetStageWrapper(*quest, *StageIndex);
 		
 		return true;
 	}
 	else
 	{
 		// Log an error or handle the failure in some way
-		UE_LOG(LogTemp, Error, TEXT("Failed to create an empty quest for %s."), *StageName);
+		UE_LOG(LogQuesto, Error, TEXT("Failed to create an empty quest for %s."), *StageName);
 		
 		// Returning false to indicate failure
 		return false;
@@ -77,20 +117,22 @@ bool UUnrealQuest::GetStage(const FString& StageName, UPARAM(ref) UUnrealStage*&
 
 bool UUnrealQuest::GetActiveStage(UPARAM(ref) UUnrealStage*& OutUnrealStage)
 {
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	Quest* quest = ResolveQuest();
+	
 	// Check if the quest was created successfully
-	if (mQuest->getActiveStage() != std::nullopt)
+	std::optional<size_t> StageIndex = quest != nullptr ? quest->getActiveStageIndex() : std::nullopt;
+	if (StageIndex != std::nullopt)
 	{
-		UUnrealStage* NewStage = NewObject<UUnrealStage>(this);
-		
-		NewStage->Initialize(*mQuest->getActiveStage());
-		OutUnrealStage = NewStage;
+		OutUnrealStage = GetStageWrapper(*quest, *StageIndex);
 		
 		return true;
 	}
 	else
 	{
 		// Log an error or handle the failure in some way
-		UE_LOG(LogTemp, Error, TEXT("Failed to retrieve active stage."));
+		UE_LOG(LogQuesto, Error, TEXT("Failed to retrieve active stage."));
 		
 		// Returning false to indicate failure
 		return false;
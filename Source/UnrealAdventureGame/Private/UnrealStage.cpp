@@ -2,6 +2,10 @@
 
 #include "UnrealStage.h"
 
+#include "UnrealQuest.h"
+
+#include "Misc/ScopeLock.h"
+
 UUnrealStage::UUnrealStage()
 {
 	// Default constructor implementation
@@ -15,62 +19,99 @@ UUnrealStage::UUnrealStage(const FObjectInitializer& ObjectInitializer)
 	// Make sure to initialize any variables here if needed
 }
 
-void UUnrealStage::Initialize(Stage& stage)
+void UUnrealStage::Initialize(UUnrealQuest* ownerQuest, size_t stageIndex)
 {
-	mStage = &stage;
+	mOwnerQuest = ownerQuest;
+	mStageIndex = stageIndex;
+	mSubStageWrappers.Reset();
 }
 
-bool UUnrealStage::GetOrCreateSubStage(const FString& SubStageName, UPARAM(ref) UUnrealSubStage*& OutUnrealSubStage)
+Stage* UUnrealStage::ResolveStage() const
 {
-	// Convert FString to std::string
-	std::string SubStageNameString(TCHAR_TO_UTF8(*SubStageName));
+	Quest* quest = mOwnerQuest != nullptr ? mOwnerQuest->ResolveQuest() : nullptr;
+	if (quest == nullptr || mStageIndex >= quest->getStageCount())
+	{
+		return nullptr;
+	}
 	
+	return &quest->getStageAt(mStageIndex);
+}
+
+QuestSystem* UUnrealStage::GetQuestSystem() const
+{
+	return mOwnerQuest != nullptr ? mOwnerQuest->GetQuestSystem() : nullptr;
+}
+
+UUnrealSubStage* UUnrealStage::GetSubStageWrapper(Stage& stage, size_t SubStageIndex)
+{
+	FScopeLock WrappersLock(&mSubStageWrappersGuard);
 	
-	// Check if the quest was created successfully
-	if (mStage->createEmptySubStage(SubStageNameString))
+	if (SubStageIndex >= static_cast<size_t>(mSubStageWrappers.Num()))
 	{
-		UUnrealSubStage* NewSubStage = NewObject<UUnrealSubStage>(this);
-		
-		NewSubStage->Initialize(*mStage->getSubStage(SubStageNameString));
-		NewSubStage->Name = SubStageName;
-		OutUnrealSubStage = NewSubStage;
-
-		return true;
+		mSubStageWrappers.SetNumZeroed(SubStageIndex + 1);
 	}
-	else
+	
+	UUnrealSubStage*& SubStageWrapper = mSubStageWrappers[SubStageIndex];
+	if (SubStageWrapper == nullptr)
 	{
-		UUnrealSubStage* NewSubStage = NewObject<UUnrealSubStage>(this);
-		
-		NewSubStage->Initialize(*mStage->getSubStage(SubStageNameString));
-		NewSubStage->Name = SubStageName;
-		OutUnrealSubStage = NewSubStage;
+		SubStageWrapper = NewObject<UUnrealSubStage>(this);
+		SubStageWrapper->Initialize(this, SubStageIndex);
+		SubStageWrapper->Name = UTF8_TO_TCHAR(stage.getSubStageAt(SubStageIndex).getName().c_str());
 	}
 	
-	return false;
+	return SubStageWrapper;
+}
+
+bool UUnrealStage::GetOrCreateSubStage(const FString& SubStageName, UPARAM(ref) UUnrealSubStage*& OutUnrealSubStage)
+{
+	QuestSystem::WriteLock Lock = QuestoUtil::writeLock(GetQuestSystem());
+	
+	Stage* stage = ResolveStage();
+	if (stage == nullptr)
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Stage %s is no longer valid."), *Name);
+		return false;
+	}
+	
+	// Convert FString to std::string
+	std::string SubStageNameString(TCHAR_TO_UTF8(*SubStageName));
+	
+	
+	// Check if the quest was created successfully
+	const bool bCreated = stage->createEmptySubStage(SubStageNameString);
+	
+	OutUnrealSubStage = GetSubStageWrapper(*stage, *stage->findSubStageIndex(SubStageNameString));
+	
+	return bCreated;
 
 }
 
 bool UUnrealStage::GetSubStage(const FString& SubStageName, UPARAM(ref) UUnrealSubStage*& OutUnrealSubStage)
 {
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	Stage* stage = ResolveStage();
+	if (stage == nullptr)
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Stage %s is no longer valid."), *Name);
+		return false;
+	}
+	
 	// Convert FString to std::string
 	std::string SubStageNameString(TCHAR_TO_UTF8(*SubStageName));
 	
 	
 	// Check if the quest was created successfully
-	if (mStage->findSubStage(SubStageNameString))
+	if (std::optional<size_t> SubStageIndex = stage->findSubStageIndex(SubStageNameString))
 	{
-		UUnrealSubStage* NewSubStage = NewObject<UUnrealSubStage>(this);
-		
-		NewSubStage->Initialize(*mStage->getSubStage(SubStageNameString));
-		NewSubStage->Name = SubStageName;
-		OutUnrealSubStage = NewSubStage;
+		OutUnrealSubStage = GetSubStageWrapper(*stage, *SubStageIndex);
 		
 		return true;
 	}
 	else
 	{
 		// Log an error or handle the failure in some way
-		UE_LOG(LogTemp, Error, TEXT("Failed to create an empty quest for %s."), *SubStageName);
+		UE_LOG(LogQuesto, Error, TEXT("Failed to create an empty quest for %s."), *SubStageName);
 		
 		// Returning false to indicate failure
 		return false;
@@ -80,20 +121,22 @@ bool UUnrealStage::GetSubStage(const FString& SubStageName, UPARAM(ref) UUnrealS
 
 bool UUnrealStage::GetActiveSubStage(UPARAM(ref) UUnrealSubStage*& OutUnrealSubStage)
 {
+	QuestSystem::ReadLock Lock = QuestoUtil::readLock(GetQuestSystem());
+	
+	Stage* stage = ResolveStage();
+	
 	// Check if the quest was created successfully
-	if (mStage->getActiveSubStage() != std::nullopt)
+	std::optional<size_t> SubStageIndex = stage != nullptr ? stage->getActiveSubStageIndex() : std::nullopt;
+	if (SubStageIndex != std::nullopt)
 	{
-		UUnrealSubStage* NewSubStage = NewObject<UUnrealSubStage>(this);
-		
-		NewSubStage->Initialize(*mStage->getActiveSubStage());
-		OutUnrealSubStage = NewSubStage;
+		OutUnrealSubStage = GetSubStageWrapper(*stage, *SubStageIndex);
 		
 		return true;
 	}
 	else
 	{
 		// Log an error or handle the failure in some way
-		UE_LOG(LogTemp, Error, TEXT("SubStage does not exist."));
+		UE_LOG(LogQuesto, Error, TEXT("SubStage does not exist."));
 		
 		// Returning false to indicate failure
 		return false;
@@ -103,9 +146,18 @@ bool UUnrealStage::GetActiveSubStage(UPARAM(ref) UUnrealSubStage*& OutUnrealSubS
 
 void UUnrealStage::CompleteSubStage(const FString& SubStageName)
 {
+	QuestSystem::WriteLock Lock = QuestoUtil::writeLock(GetQuestSystem());
+	
+	Stage* stage = ResolveStage();
+	if (stage == nullptr)
+	{
+		UE_LOG(LogQuesto, Error, TEXT("Stage %s is no longer valid."), *Name);
+		return;
+	}
+	
 	// Convert FString to std::string
 	std::string SubStageNameString(TCHAR_TO_UTF8(*SubStageName));
 	
-	mStage->completeSubStage(SubStageNameString);
+	stage->completeSubStage(SubStageNameString);
 	
 }
@@ -2,6 +2,10 @@
 
 #include "UnrealSubStage.h"
 
+#include "UnrealStage.h"
+
+#include "Misc/ScopeLock.h"
+
 UUnrealSubStage::UUnrealSubStage()
 {
 }
@@ -11,57 +15,124 @@ UUnrealSubStage::UUnrealSubStage(const FObjectInitializer& ObjectInitializer)
 {
 }
 
-void UUnrealSubStage::Initialize(SubStage& subStage)
+void UUnrealSubStage::Initialize(UUnrealStage* ownerStage, size_t subStageIndex)
+{
+	mOwnerStage = ownerStage;
+	mSubStageIndex = subStageIndex;
+	mDialogWrappers.Reset();
+}
+
+SubStage* UUnrealSubStage::ResolveSubStage() const
+{
+	Stage* stage = mOwnerStage != nullptr ? mOwnerStage->ResolveStage() : nullptr;
+	if (stage == nullptr || mSubStageIndex >= stage->getSubStageCount())
+	{
+		return nullptr;
+	}
+	
+	return &stage->getSubStageAt(mSubStageIndex);
+}
+
+QuestSystem* UUnrealSubStage::GetQuestSystem() const
 {
-	mSubStage = &subStage;
+	return mOwnerStage != nullptr ? mOwnerStage->GetQuestSystem() : nullptr;
 }
 
 
 void UUnrealSubStage::SetDialogForCharacter(const FString& Id, const FString& Content)
 {
+	QuestSystem::WriteLock Lock = QuestoUtil::writeLock(GetQuestSystem());
+	
 	std::string IdString(TCHAR_TO_UTF8(*Id));
 	std::string ContentString(TCHAR_TO_UTF8(*Content));
 
-	mSubStage->setDialogString(IdString, ContentString);
+	if (SubStage* subStage = ResolveSubStage())
+	{
+		subStage->setDialogString(IdString, ContentString);
+	}
 }
 
 void UUnrealSubStage::ClearGibberishForCharacter(const FString& Id)
 {
+	QuestSystem::WriteLock Lock = QuestoUtil::writeLock(GetQuestSystem());
+	
 	std::string IdString(TCHAR_TO_UTF8(*Id));
 		
-	mSubStage->clearGibberishForCharacter(IdString);
+	if (SubStage* subStage = ResolveSubStage())
+	{
+		subStage->clearGibberishForCharacter(IdString);
+	}
 }
 
 
 void UUnrealSubStage::AppendGibberishForCharacter(const FString& character, const FString& id, const TArray<uint8>& gibberish)
 {
+	QuestSystem::WriteLock Lock = QuestoUtil::writeLock(GetQuestSystem());
+	
 	std::string CharacterString(TCHAR_TO_UTF8(*character));
 	std::string IdString(TCHAR_TO_UTF8(*id));
 
 	std::vector<unsigned char> stdVector;
 	stdVector.assign(gibberish.GetData(), gibberish.GetData() + gibberish.Num());
 	
-	mSubStage->appendGibberishForCharacter(CharacterString, IdString, stdVector);
+	if (SubStage* subStage = ResolveSubStage())
+	{
+		subStage->appendGibberishForCharacter(CharacterString, IdString, stdVector);
+	}
 }
 
 
-bool UUnrealSubStage::GetDialogForCharacter(const FString& Id, UPARAM(ref) UUnrealDialog*& OutUnrealDialog)
+UUnrealDialog* UUnrealSubStage::FindDialogWrapper(const FString& Id) const
 {
-	std::string DialogIdString(TCHAR_TO_UTF8(*Id));
+	// Character ids are case-sensitive in the quest model, so compare them the same way here
+	for (UUnrealDialog* DialogWrapper : mDialogWrappers)
+	{
+		if (DialogWrapper->CharacterId.Equals(Id, ESearchCase::CaseSensitive))
+		{
+			return DialogWrapper;
+		}
+	}
+	
+	return nullptr;
+}
 
+bool UUnrealSubStage::GetDialogForCharacter(const FString& Id, UPARAM(ref) UUnrealDialog*& OutUnrealDialog)
+{
+	{
+		FScopeLock WrappersLock(&mDialogWrappersGuard);
+		if (UUnrealDialog* DialogWrapper = FindDialogWrapper(Id))
+		{
+			OutUnrealDialog = DialogWrapper;
+			return true;
+		}
+	}
+	
+	// The wrappers guard is only taken after the write lock, in the same order as the read-locked lookups of the other wrappers
+	QuestSystem::WriteLock Lock = QuestoUtil::writeLock(GetQuestSystem());
+	FScopeLock WrappersLock(&mDialogWrappersGuard);
+	
+	// Another caller may have created the wrapper while the write lock was being taken
+	if (UUnrealDialog* DialogWrapper = FindDialogWrapper(Id))
+	{
+		OutUnrealDialog = DialogWrapper;
+		return true;
+	}
+	
+	SubStage* subStage = ResolveSubStage();
 	Dialog* dialog = nullptr;
 	
-	if(mSubStage->getDialog(DialogIdString, &dialog)){
+	// Make sure the dialog exists, so the wrapper can resolve it without modifying the sub-stage
+	if(subStage != nullptr && subStage->getDialog(TCHAR_TO_UTF8(*Id), &dialog)){
 		UUnrealDialog* NewDialog = NewObject<UUnrealDialog>(this);
 		
-		NewDialog->Initialize(*dialog);
-		NewDialog->CharacterId = Id;
+		NewDialog->Initialize(this, Id);
+		mDialogWrappers.Add(NewDialog);
 		OutUnrealDialog = NewDialog;
 
 		return true;
 		
 	} else {
-		UE_LOG(LogTemp, Error, TEXT("Failed to retrieve dialog for character %s."), *Id);
+		UE_LOG(LogQuesto, Error, TEXT("Failed to retrieve dialog for character %s."), *Id);
 		
 		return false;
 	}
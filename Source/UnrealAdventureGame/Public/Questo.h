@@ -4,14 +4,34 @@
 
 #include "CoreMinimal.h"
 #include "Math/UnrealMathUtility.h"
+#include "Stats/Stats.h"
 
-#include <iostream>
 #include <vector>
 #include <random>
 #include <map>
+#include <unordered_map>
 #include <string>
 #include <algorithm>  // For std::transform
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 #include <optional>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+// Verbose diagnostics compile out of Shipping builds. Exported for the inline quest system code compiled into the tests module
+#if UE_BUILD_SHIPPING
+UNREALADVENTUREGAME_API DECLARE_LOG_CATEGORY_EXTERN(LogQuesto, Log, Warning);
+#else
+UNREALADVENTUREGAME_API DECLARE_LOG_CATEGORY_EXTERN(LogQuesto, Log, All);
+#endif
+
+DECLARE_STATS_GROUP(TEXT("Questo"), STATGROUP_Questo, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Name lookups"), STAT_QuestoLookups, STATGROUP_Questo, UNREALADVENTUREGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Name lookup misses"), STAT_QuestoLookupMisses, STATGROUP_Questo, UNREALADVENTUREGAME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Entries created"), STAT_QuestoCreations, STATGROUP_Questo, UNREALADVENTUREGAME_API);
 
 namespace QuestoUtil {
 
@@ -21,6 +41,180 @@ static std::string getLowerCase(const std::string& name) {
 	return lowerCaseName;
 }
 
+// Case-insensitive hash and equality so name lookups never have to build a lowercase copy
+struct CaseInsensitiveHash {
+	size_t operator()(const std::string& name) const noexcept {
+		// FNV-1a over the lowercased characters
+		size_t hash = static_cast<size_t>(14695981039346656037ULL);
+		for (unsigned char c : name) {
+			hash ^= static_cast<size_t>(std::tolower(c));
+			hash *= static_cast<size_t>(1099511628211ULL);
+		}
+		return hash;
+	}
+};
+
+struct CaseInsensitiveEqual {
+	bool operator()(const std::string& a, const std::string& b) const noexcept {
+		if (a.size() != b.size()) {
+			return false;
+		}
+		for (size_t i = 0; i < a.size(); ++i) {
+			if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+// Maps a case-insensitive name to its position in the owning vector. Indices stay valid as entries are appended
+using NameIndex = std::unordered_map<std::string, size_t, CaseInsensitiveHash, CaseInsensitiveEqual>;
+
+// Name lookup used by the query functions, counted in stat Questo
+inline NameIndex::const_iterator lookup(const NameIndex& index, const std::string& name) {
+	INC_DWORD_STAT(STAT_QuestoLookups);
+	
+	auto it = index.find(name);
+	if (it == index.end()) {
+		INC_DWORD_STAT(STAT_QuestoLookupMisses);
+	}
+	return it;
+}
+
+// Position of the first entry that may still be incomplete. Completion never reverts and entries are only appended, so
+// the cursor only moves forward and can be advanced lazily, even by concurrent readers holding a shared lock
+class ProgressCursor {
+private:
+	mutable std::atomic<size_t> position{0};
+
+public:
+	ProgressCursor() = default;
+	ProgressCursor(const ProgressCursor& other) : position(other.get()) {}
+	
+	ProgressCursor& operator=(const ProgressCursor& other) {
+		position.store(other.get(), std::memory_order_relaxed);
+		return *this;
+	}
+	
+	size_t get() const {
+		return position.load(std::memory_order_relaxed);
+	}
+	
+	void advanceTo(size_t newPosition) const {
+		size_t current = get();
+		while (current < newPosition && !position.compare_exchange_weak(current, newPosition, std::memory_order_relaxed)) {
+		}
+	}
+	
+	void reset() {
+		position.store(0, std::memory_order_relaxed);
+	}
+};
+
+// Advances cursor past the completed prefix of entries and returns the active position: the first incomplete entry,
+// or the last entry once everything is complete
+template <typename T>
+std::optional<size_t> advanceProgress(const ProgressCursor& cursor, const std::vector<T>& entries) {
+	if (entries.empty()) {
+		return std::nullopt;
+	}
+	
+	size_t position = cursor.get();
+	while (position < entries.size() && entries[position].isComplete()) {
+		++position;
+	}
+	cursor.advanceTo(position);
+	
+	return position < entries.size() ? position : entries.size() - 1;
+}
+
+// Snapshot header. Values are stored in host byte order, which is little-endian on every platform we ship
+static constexpr uint32_t SnapshotMagic = 0x4F545351; // "QSTO"
+static constexpr uint32_t SnapshotVersion = 1;
+
+// Appends snapshot values to a byte buffer
+class ByteWriter {
+private:
+	std::vector<unsigned char>& out;
+
+public:
+	explicit ByteWriter(std::vector<unsigned char>& output) : out(output) {}
+	
+	template <typename T>
+	void write(T value) {
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+		writeBytes(reinterpret_cast<const unsigned char*>(&value), sizeof(T));
+	}
+	
+	void writeBytes(const unsigned char* data, size_t size) {
+		out.insert(out.end(), data, data + size);
+	}
+	
+	void writeString(const std::string& value) {
+		write<uint32_t>(static_cast<uint32_t>(value.size()));
+		writeBytes(reinterpret_cast<const unsigned char*>(value.data()), value.size());
+	}
+	
+	void writeBlob(const unsigned char* data, size_t size) {
+		write<uint64_t>(static_cast<uint64_t>(size));
+		writeBytes(data, size);
+	}
+};
+
+// Reads snapshot values from a non-owning byte range (a loaded buffer or a mapped file region)
+class ByteReader {
+private:
+	const unsigned char* data;
+	size_t size;
+	size_t offset;
+
+public:
+	ByteReader(const unsigned char* inputData, size_t inputSize) : data(inputData), size(inputSize), offset(0) {}
+	
+	size_t remaining() const {
+		return size - offset;
+	}
+	
+	template <typename T>
+	bool read(T& value) {
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read");
+		if (remaining() < sizeof(T)) {
+			return false;
+		}
+		std::memcpy(&value, data + offset, sizeof(T));
+		offset += sizeof(T);
+		return true;
+	}
+	
+	bool readString(std::string& value) {
+		uint32_t length = 0;
+		if (!read(length) || remaining() < length) {
+			return false;
+		}
+		value.assign(reinterpret_cast<const char*>(data + offset), length);
+		offset += length;
+		return true;
+	}
+	
+	// Points value at the blob bytes inside the source range instead of copying them
+	bool readBlobView(const unsigned char*& value, size_t& valueSize) {
+		uint64_t length = 0;
+		if (!read(length) || remaining() < length) {
+			return false;
+		}
+		value = data + offset;
+		valueSize = static_cast<size_t>(length);
+		offset += valueSize;
+		return true;
+	}
+	
+	// Reads an element count, rejecting counts that could not possibly fit in the remaining bytes
+	bool readCount(uint32_t& count) {
+		return read(count) && count <= remaining();
+	}
+};
+
 }
 
 using CharacterId = std::string;
@@ -28,13 +222,77 @@ using GibberishId = std::string;
 
 // Class representing a dialogue
 class Dialog {
+public:
+	// Non-owning view of one gibberish clip inside the dialog arena. Invalidated by appendGibberish and clearGibberish
+	struct GibberishView {
+		const unsigned char* data = nullptr;
+		size_t size = 0;
+		
+		bool empty() const {
+			return size == 0;
+		}
+	};
+
 private:
+	struct GibberishClip {
+		GibberishId id;
+		size_t offset;
+		size_t size;
+	};
+	
 	std::string content;
-	std::map<GibberishId, std::vector<unsigned char>> gibberish;
+	
+	// All clips of this dialog live back to back in one buffer, addressed by position
+	std::vector<unsigned char> gibberishArena;
+	std::vector<GibberishClip> gibberishClips;
+	std::unordered_map<GibberishId, size_t> gibberishIndex;
+	
+	// Bytes in the arena no longer referenced by a clip, left behind when a clip is replaced
+	size_t gibberishDeadBytes = 0;
+	
+	void storeGibberish(const GibberishId& gibberishId, const unsigned char* audio, size_t size) {
+		auto it = gibberishIndex.find(gibberishId);
+		if (it != gibberishIndex.end()) {
+			GibberishClip& clip = gibberishClips[it->second];
+			if (clip.size == size) {
+				// Same length, overwrite in place
+				std::copy(audio, audio + size, gibberishArena.begin() + clip.offset);
+				return;
+			}
+			
+			gibberishDeadBytes += clip.size;
+			clip.offset = gibberishArena.size();
+			clip.size = size;
+		} else {
+			gibberishIndex.emplace(gibberishId, gibberishClips.size());
+			gibberishClips.push_back({gibberishId, gibberishArena.size(), size});
+		}
+		
+		gibberishArena.insert(gibberishArena.end(), audio, audio + size);
+		
+		if (gibberishDeadBytes > gibberishArena.size() / 2) {
+			compactGibberish();
+		}
+	}
+	
+	void compactGibberish() {
+		std::vector<unsigned char> compacted;
+		compacted.reserve(gibberishArena.size() - gibberishDeadBytes);
+		for (GibberishClip& clip : gibberishClips) {
+			const size_t offset = compacted.size();
+			compacted.insert(compacted.end(), gibberishArena.begin() + clip.offset, gibberishArena.begin() + clip.offset + clip.size);
+			clip.offset = offset;
+		}
+		gibberishArena = std::move(compacted);
+		gibberishDeadBytes = 0;
+	}
 
 public:
 	Dialog(const std::string& content, const std::map<GibberishId,
-		   std::vector<unsigned char>>& audio) : content(content), gibberish(audio) {
+		   std::vector<unsigned char>>& audio) : content(content) {
+		for (const auto& pair : audio) {
+			appendGibberish(pair.first, pair.second);
+		}
 	}
 	
 	// Function to display the dialogue with the specified index
@@ -42,34 +300,83 @@ public:
 		return content;
 	}
 	
-	// Function to display the dialogue with the specified index
-	const std::vector<unsigned char> getGibberish() const {
-		if (!gibberish.empty()) {
+	size_t getGibberishCount() const {
+		return gibberishClips.size();
+	}
+	
+	// Returns the clip at the given position without copying it
+	GibberishView getGibberishView(size_t gibberishPosition) const {
+		if (gibberishPosition >= gibberishClips.size()) {
+			return {};
+		}
+		
+		const GibberishClip& clip = gibberishClips[gibberishPosition];
+		return {gibberishArena.data() + clip.offset, clip.size};
+	}
+	
+	// Returns a random clip without copying it
+	GibberishView getRandomGibberishView() const {
+		if (!gibberishClips.empty()) {
 			
-			static std::random_device rd;
-			static std::mt19937 gen(rd());
-			std::uniform_int_distribution<size_t> distribution(0, gibberish.size() - 1);
-			size_t randomIndex = distribution(gen);
-
-			auto it = std::next(std::begin(gibberish), randomIndex);
+			// One generator per thread, so picking a clip never races between threads
+			static thread_local std::mt19937 gen(std::random_device{}());
+			std::uniform_int_distribution<size_t> distribution(0, gibberishClips.size() - 1);
 			
-			return it->second;
+			return getGibberishView(distribution(gen));
 
 		} else {
 			return {};
 		}
 	}
 	
+	// Function to display the dialogue with the specified index
+	const std::vector<unsigned char> getGibberish() const {
+		GibberishView view = getRandomGibberishView();
+		return std::vector<unsigned char>(view.data, view.data + view.size);
+	}
+	
 	void setString(const std::string& dialog){
 		content = dialog;
 	}
 
 	void appendGibberish(const GibberishId& gibberishId, const std::vector<unsigned char>& audio){
-		gibberish[gibberishId] = audio;
+		storeGibberish(gibberishId, audio.data(), audio.size());
 	}
 
 	void clearGibberish() {
-		gibberish.clear();
+		gibberishArena.clear();
+		gibberishClips.clear();
+		gibberishIndex.clear();
+		gibberishDeadBytes = 0;
+	}
+	
+	void save(QuestoUtil::ByteWriter& writer) const {
+		writer.writeString(content);
+		writer.write<uint32_t>(static_cast<uint32_t>(gibberishClips.size()));
+		for (const GibberishClip& clip : gibberishClips) {
+			writer.writeString(clip.id);
+			writer.writeBlob(gibberishArena.data() + clip.offset, clip.size);
+		}
+	}
+	
+	bool load(QuestoUtil::ByteReader& reader) {
+		uint32_t gibberishCount = 0;
+		if (!reader.readString(content) || !reader.readCount(gibberishCount)) {
+			return false;
+		}
+		
+		clearGibberish();
+		for (uint32_t i = 0; i < gibberishCount; ++i) {
+			GibberishId gibberishId;
+			const unsigned char* audio = nullptr;
+			size_t audioSize = 0;
+			if (!reader.readString(gibberishId) || !reader.readBlobView(audio, audioSize)) {
+				return false;
+			}
+			// Copied straight from the snapshot bytes into the arena
+			storeGibberish(gibberishId, audio, audioSize);
+		}
+		return true;
 	}
 };
 
@@ -86,13 +393,19 @@ public:
 	// Function to complete the sub-stage
 	void complete() {
 		completed = true;
-		std::cout << "Sub-Stage completed!" << std::endl;
+		UE_LOG(LogQuesto, Verbose, TEXT("Sub-stage %s completed"), UTF8_TO_TCHAR(name.c_str()));
 	}
 	
-	bool isComplete() {
+	bool isComplete() const {
 		return completed;
 	}
 	
+	// Returns the Dialog for a specific character without creating it, or nullptr
+	Dialog* findDialog(const CharacterId& character) {
+		auto it = dialog.find(character);
+		return it != dialog.end() ? &it->second : nullptr;
+	}
+	
 	// Function to get the Dialog for a specific character
 	bool getDialog(CharacterId character, Dialog** outDialog) {
 		auto it = std::find_if(dialog.begin(), dialog.end(),
@@ -132,11 +445,45 @@ public:
 		}
 	}
 	
+	const std::string& getName() const {
+		return name;
+	}
+	
 	std::string getLowerCaseName() const {
 		std::string lowerCaseName = name;
 		std::transform(lowerCaseName.begin(), lowerCaseName.end(), lowerCaseName.begin(), ::tolower);
 		return lowerCaseName;
 	}
+	
+	void save(QuestoUtil::ByteWriter& writer) const {
+		writer.writeString(name);
+		writer.write<uint8_t>(completed ? 1 : 0);
+		writer.write<uint32_t>(static_cast<uint32_t>(dialog.size()));
+		for (const auto& pair : dialog) {
+			writer.writeString(pair.first);
+			pair.second.save(writer);
+		}
+	}
+	
+	bool load(QuestoUtil::ByteReader& reader) {
+		uint8_t completedFlag = 0;
+		uint32_t dialogCount = 0;
+		if (!reader.readString(name) || !reader.read(completedFlag) || !reader.readCount(dialogCount)) {
+			return false;
+		}
+		
+		completed = completedFlag != 0;
+		dialog.clear();
+		for (uint32_t i = 0; i < dialogCount; ++i) {
+			CharacterId character;
+			Dialog characterDialog("", {});
+			if (!reader.readString(character) || !characterDialog.load(reader)) {
+				return false;
+			}
+			dialog.emplace(std::move(character), std::move(characterDialog));
+		}
+		return true;
+	}
 };
 
 // Class representing a stage
@@ -145,58 +492,72 @@ private:
 	std::string name;  // Added a name for the quest
 	
 	std::vector<SubStage> subStages;
+	QuestoUtil::NameIndex subStageNameIndex;
+	QuestoUtil::ProgressCursor activeSubStageCursor;
 	bool completed;
 	
+	void rebuildIndex() {
+		subStageNameIndex.clear();
+		subStageNameIndex.reserve(subStages.size());
+		for (size_t i = 0; i < subStages.size(); ++i) {
+			// emplace keeps the first entry on duplicates, matching the previous linear search
+			subStageNameIndex.emplace(subStages[i].getName(), i);
+		}
+		activeSubStageCursor.reset();
+	}
+	
 public:
-	Stage(const std::string& inputName, const std::vector<SubStage>& inputSubStages) : name(inputName), subStages(inputSubStages), completed(false) {}
+	Stage(const std::string& inputName, const std::vector<SubStage>& inputSubStages) : name(inputName), subStages(inputSubStages), completed(false) {
+		rebuildIndex();
+	}
 	
-	bool isComplete() {
+	bool isComplete() const {
 		return areAllStagesCompleted();
 	}
 	
 	// Function to complete the current sub-stage
 	void completeSubStage(const std::string& subStageName) {
 		if(subStages.empty()){
-			std::cout << "There are no substages for this stage!" << std::endl;
+			UE_LOG(LogQuesto, Warning, TEXT("Stage %s has no sub-stages to complete"), UTF8_TO_TCHAR(name.c_str()));
 		} else {
 			auto substage = getSubStage(subStageName);
 			
 			if(substage != std::nullopt){
-				getSubStage(subStageName).value().get().complete();
+				substage.value().get().complete();
+				
+				// Latch the completed flag here, on the write path, so checking completion never mutates the stage
+				completed = areAllStagesCompleted();
 			}
 		}
 	}
 	
-	bool areAllStagesCompleted() {
+	bool areAllStagesCompleted() const {
 		if(subStages.empty()){
 			return false;
 		}
 		
 		if (!completed) {
-			for (auto& subStage : subStages) {
+			for (const auto& subStage : subStages) {
 				if (!subStage.isComplete()) {
 					return false;
 				}
 			}
-			
-			completed = true;
 		}
-		return completed;
+		return true;
 	}
 	
 	bool createEmptySubStage(const std::string& subStageName)
 	{
 		// Check if the stageName already exists in a case-insensitive manner
-		std::string lowerCaseStageName = QuestoUtil::getLowerCase(subStageName);
-		auto it = std::find_if(subStages.begin(), subStages.end(),
-							   [lowerCaseStageName](const SubStage& subStage)
-							   {
-			return subStage.getLowerCaseName() == lowerCaseStageName;
-		});
-		
-		if (it == subStages.end())
+		if (subStageNameIndex.find(subStageName) == subStageNameIndex.end())
 		{
+			// Latch completion first, so appending a sub-stage never turns a completed stage back into an active one
+			completed = areAllStagesCompleted();
+			
+			std::string lowerCaseStageName = QuestoUtil::getLowerCase(subStageName);
 			subStages.push_back(SubStage(lowerCaseStageName));
+			subStageNameIndex.emplace(std::move(lowerCaseStageName), subStages.size() - 1);
+			INC_DWORD_STAT(STAT_QuestoCreations);
 			return true;  // Indicate success
 		}
 		else
@@ -209,14 +570,7 @@ public:
 	bool findSubStage(const std::string& subStageName)
 	{
 		// Check if the stageName already exists in a case-insensitive manner
-		std::string lowerCaseStageName = QuestoUtil::getLowerCase(subStageName);
-		auto it = std::find_if(subStages.begin(), subStages.end(),
-							   [lowerCaseStageName](const SubStage& subStage)
-							   {
-			return subStage.getLowerCaseName() == lowerCaseStageName;
-		});
-		
-		if (it != subStages.end())
+		if (QuestoUtil::lookup(subStageNameIndex, subStageName) != subStageNameIndex.end())
 		{
 			return true;  // Indicate success
 		}
@@ -236,40 +590,86 @@ public:
 		}
 	}
 	
+	std::optional<size_t> findSubStageIndex(const std::string& subStageName) const {
+		auto it = QuestoUtil::lookup(subStageNameIndex, subStageName);
+		if (it != subStageNameIndex.end()) {
+			return it->second;
+		}
+		return std::nullopt;
+	}
+	
+	size_t getSubStageCount() const {
+		return subStages.size();
+	}
+	
+	SubStage& getSubStageAt(size_t subStagePosition) {
+		return subStages[subStagePosition];
+	}
+	
 	std::optional<std::reference_wrapper<SubStage>> getSubStage(const std::string& subStageName) {
-		std::string lowerCaseSubStageName = QuestoUtil::getLowerCase(subStageName);
-
-		// Find the quest based on the lowercase name
-		auto it = std::find_if(subStages.begin(), subStages.end(),
-							   [&lowerCaseSubStageName](const SubStage& s) { return s.getLowerCaseName() == lowerCaseSubStageName; });
+		// Find the sub-stage through the case-insensitive index
+		auto it = QuestoUtil::lookup(subStageNameIndex, subStageName);
 		
-		if (it != subStages.end()) {
-			return *it;
+		if (it != subStageNameIndex.end()) {
+			return subStages[it->second];
 		} else {
-			std::cout << "SubStage not found" << std::endl;
+			UE_LOG(LogQuesto, Verbose, TEXT("Sub-stage %s not found"), UTF8_TO_TCHAR(subStageName.c_str()));
 			return std::nullopt;
 		}
 	}
 	
 	std::optional<std::reference_wrapper<SubStage>> getActiveSubStage() {
-		if(subStages.empty()){
-			return std::nullopt;
-		} else {
-			
-			for (auto& subStage : subStages) {
-				if (!subStage.isComplete()) {
-					return subStage;
-				}
-			}
+		if (std::optional<size_t> activeIndex = getActiveSubStageIndex()) {
+			return subStages[*activeIndex];
 		}
 		
-		return subStages.back();;
+		return std::nullopt;
+	}
+	
+	// Amortised O(1): the active position is tracked and only moves forward as sub-stages complete
+	std::optional<size_t> getActiveSubStageIndex() const {
+		return QuestoUtil::advanceProgress(activeSubStageCursor, subStages);
+	}
+	
+	const std::string& getName() const {
+		return name;
 	}
+	
 	std::string getLowerCaseName() const {
 		std::string lowerCaseName = name;
 		std::transform(lowerCaseName.begin(), lowerCaseName.end(), lowerCaseName.begin(), ::tolower);
 		return lowerCaseName;
 	}
+	
+	void save(QuestoUtil::ByteWriter& writer) const {
+		writer.writeString(name);
+		writer.write<uint8_t>(completed ? 1 : 0);
+		writer.write<uint32_t>(static_cast<uint32_t>(subStages.size()));
+		for (const SubStage& subStage : subStages) {
+			subStage.save(writer);
+		}
+	}
+	
+	bool load(QuestoUtil::ByteReader& reader) {
+		uint8_t completedFlag = 0;
+		uint32_t subStageCount = 0;
+		if (!reader.readString(name) || !reader.read(completedFlag) || !reader.readCount(subStageCount)) {
+			return false;
+		}
+		
+		completed = completedFlag != 0;
+		subStages.clear();
+		subStages.reserve(subStageCount);
+		for (uint32_t i = 0; i < subStageCount; ++i) {
+			SubStage subStage("");
+			if (!subStage.load(reader)) {
+				return false;
+			}
+			subStages.push_back(std::move(subStage));
+		}
+		rebuildIndex();
+		return true;
+	}
 };
 
 // Class representing a quest
@@ -277,24 +677,33 @@ class Quest {
 private:
 	std::string name;  // Added a name for the quest
 	std::vector<Stage> stages;
+	QuestoUtil::NameIndex stageNameIndex;
+	QuestoUtil::ProgressCursor activeStageCursor;
+	
+	void rebuildIndex() {
+		stageNameIndex.clear();
+		stageNameIndex.reserve(stages.size());
+		for (size_t i = 0; i < stages.size(); ++i) {
+			stageNameIndex.emplace(stages[i].getName(), i);
+		}
+		activeStageCursor.reset();
+	}
 	
 public:
-	Quest(const std::string& inputName, const std::vector<Stage>& inputStages) : name(inputName), stages(inputStages) {}
+	Quest(const std::string& inputName, const std::vector<Stage>& inputStages) : name(inputName), stages(inputStages) {
+		rebuildIndex();
+	}
 	
 	bool createEmptyStage(const std::string& stageName)
 	{
 		// Check if the stageName already exists in a case-insensitive manner
-		std::string lowerCaseStageName = QuestoUtil::getLowerCase(stageName);
-		auto it = std::find_if(stages.begin(), stages.end(),
-							   [lowerCaseStageName](const Stage& stage)
-							   {
-			return stage.getLowerCaseName() == lowerCaseStageName;
-		});
-		
-		if (it == stages.end())
+		if (stageNameIndex.find(stageName) == stageNameIndex.end())
 		{
 			// Stage with the given name doesn't exist, add a new one
+			std::string lowerCaseStageName = QuestoUtil::getLowerCase(stageName);
 			stages.push_back(Stage({lowerCaseStageName, {}}));
+			stageNameIndex.emplace(std::move(lowerCaseStageName), stages.size() - 1);
+			INC_DWORD_STAT(STAT_QuestoCreations);
 			return true;  // Indicate success
 		}
 		else
@@ -307,14 +716,7 @@ public:
 	bool findStage(const std::string& stageName)
 	{
 		// Check if the stageName already exists in a case-insensitive manner
-		std::string lowerCaseStageName = QuestoUtil::getLowerCase(stageName);
-		auto it = std::find_if(stages.begin(), stages.end(),
-							   [lowerCaseStageName](const Stage& stage)
-							   {
-			return stage.getLowerCaseName() == lowerCaseStageName;
-		});
-		
-		if (it != stages.end())
+		if (QuestoUtil::lookup(stageNameIndex, stageName) != stageNameIndex.end())
 		{
 			return true;  // Indicate success
 		}
@@ -326,8 +728,8 @@ public:
 	}
 
 	// Function to check if all stages are completed
-	bool areAllStagesCompleted() {
-		for (auto& stage : stages) {
+	bool areAllStagesCompleted() const {
+		for (const auto& stage : stages) {
 			if (!stage.isComplete()) {
 				return false;
 			}
@@ -335,37 +737,52 @@ public:
 		return true;
 	}
 	
+	std::optional<size_t> findStageIndex(const std::string& stageName) const {
+		auto it = QuestoUtil::lookup(stageNameIndex, stageName);
+		if (it != stageNameIndex.end()) {
+			return it->second;
+		}
+		return std::nullopt;
+	}
+	
+	size_t getStageCount() const {
+		return stages.size();
+	}
+	
+	Stage& getStageAt(size_t stagePosition) {
+		return stages[stagePosition];
+	}
+	
 	// Function to get a quest from the system
 	std::optional<std::reference_wrapper<Stage>> getStage(const std::string& stageName) {
 		
-		std::string lowerCaseStageName = QuestoUtil::getLowerCase(stageName);
-
-		// Find the quest based on the lowercase name
-		auto it = std::find_if(stages.begin(), stages.end(),
-							   [&lowerCaseStageName](const Stage& s) { return s.getLowerCaseName() == lowerCaseStageName; });
+		// Find the stage through the case-insensitive index
+		auto it = QuestoUtil::lookup(stageNameIndex, stageName);
 		
-		if (it != stages.end()) {
-			return *it;
+		if (it != stageNameIndex.end()) {
+			return stages[it->second];
 		} else {
-			std::cout << "Stage not found" << std::endl;
+			UE_LOG(LogQuesto, Verbose, TEXT("Stage %s not found"), UTF8_TO_TCHAR(stageName.c_str()));
 			return std::nullopt;
 		}
 	}
 	
 	std::optional<std::reference_wrapper<Stage>> getActiveStage() {
-		if(stages.empty()){
-			return std::nullopt;
-		} else {
-			for (auto& stage : stages) {
-				if (!stage.isComplete()) {
-					return stage;
-				}
-			}
+		if (std::optional<size_t> activeIndex = getActiveStageIndex()) {
+			return stages[*activeIndex];
 		}
 		
-		return stages.back();
+		return std::nullopt;
+	}
+	
+	// Amortised O(1): the active position is tracked and only moves forward as stages complete
+	std::optional<size_t> getActiveStageIndex() const {
+		return QuestoUtil::advanceProgress(activeStageCursor, stages);
 	}
 
+	const std::string& getName() const {
+		return name;
+	}
 	
 	// Function to get the quest name in lowercase
 	std::string getLowerCaseName() const {
@@ -373,15 +790,57 @@ public:
 		std::transform(lowerCaseName.begin(), lowerCaseName.end(), lowerCaseName.begin(), ::tolower);
 		return lowerCaseName;
 	}
+	
+	void save(QuestoUtil::ByteWriter& writer) const {
+		writer.writeString(name);
+		writer.write<uint32_t>(static_cast<uint32_t>(stages.size()));
+		for (const Stage& stage : stages) {
+			stage.save(writer);
+		}
+	}
+	
+	bool load(QuestoUtil::ByteReader& reader) {
+		uint32_t stageCount = 0;
+		if (!reader.readString(name) || !reader.readCount(stageCount)) {
+			return false;
+		}
+		
+		stages.clear();
+		stages.reserve(stageCount);
+		for (uint32_t i = 0; i < stageCount; ++i) {
+			Stage stage("", {});
+			if (!stage.load(reader)) {
+				return false;
+			}
+			stages.push_back(std::move(stage));
+		}
+		rebuildIndex();
+		return true;
+	}
 };
 
 // Class representing a quest system
+//
+// The quest system is not synchronised by default. Call setConcurrentAccess(true) before touching it from more than one
+// thread; from then on every caller must hold readLock() for lookups and writeLock() for anything that creates, completes
+// or modifies entries. References and gibberish views obtained under a lock are only valid while that lock is held.
 class QuestSystem {
 private:
+	mutable std::shared_mutex accessMutex;
+	std::atomic<bool> concurrentAccess{false};
+	
 	std::vector<Quest> quests;
+	QuestoUtil::NameIndex questNameIndex;
 	std::string activeQuest;
+	// Position of activeQuest in quests, kept in sync whenever the active quest or the quest list changes
+	std::optional<size_t> activeQuestIndex;
+	// Bumped whenever the graph is replaced wholesale, so index-based handles can detect they went stale
+	uint32_t generation = 0;
 	
 public:
+	using ReadLock = std::shared_lock<std::shared_mutex>;
+	using WriteLock = std::unique_lock<std::shared_mutex>;
+	
 	QuestSystem() {
 		std::vector<SubStage> subStages1 = {{"main"}};
 		
@@ -392,75 +851,201 @@ public:
 		
 		addQuest(mainQuest);
 		
-		activeQuest = "main";
+		setActiveQuest("main");
+	}
+	
+	QuestSystem(const QuestSystem&) = delete;
+	QuestSystem& operator=(const QuestSystem&) = delete;
+	
+	// Opt-in locking. Enable before sharing the system across threads and only disable once no other thread uses it
+	void setConcurrentAccess(bool enabled) {
+		concurrentAccess.store(enabled, std::memory_order_release);
+	}
+	
+	bool isConcurrentAccessEnabled() const {
+		return concurrentAccess.load(std::memory_order_acquire);
+	}
+	
+	// Shared lock for lookups. Does not lock anything unless concurrent access is enabled
+	ReadLock readLock() const {
+		return isConcurrentAccessEnabled() ? ReadLock(accessMutex) : ReadLock();
+	}
+	
+	// Exclusive lock for modifications. Does not lock anything unless concurrent access is enabled
+	WriteLock writeLock() const {
+		return isConcurrentAccessEnabled() ? WriteLock(accessMutex) : WriteLock();
 	}
 	
 	bool createEmptyQuest(const std::string& questName){
-		std::string lowerCaseName = QuestoUtil::getLowerCase(questName);
-
-		if(getQuest(lowerCaseName) != std::nullopt){
+		if(questNameIndex.find(questName) != questNameIndex.end()){
 			return false;
 		} else {
-			addQuest({lowerCaseName, {}});
+			addQuest({QuestoUtil::getLowerCase(questName), {}});
+			INC_DWORD_STAT(STAT_QuestoCreations);
 			return true;
 		}
 	}
 	
 	bool findQuest(const std::string& questName){
-		std::string lowerCaseName = QuestoUtil::getLowerCase(questName);
-
-		if(getQuest(lowerCaseName) != std::nullopt){
-			return true;
-		} else {
-			return false;
-		}
+		return QuestoUtil::lookup(questNameIndex, questName) != questNameIndex.end();
 	}
 	
 	void setActiveQuest(const std::string& questName){
-		std::string lowerCaseName = QuestoUtil::getLowerCase(questName);
-		
-		if(getQuest(lowerCaseName) != std::nullopt){
+		auto it = QuestoUtil::lookup(questNameIndex, questName);
+		if(it != questNameIndex.end()){
 			activeQuest = questName;
+			activeQuestIndex = it->second;
 		} 
 	}
 	
 	// Function to get a quest from the system
 	std::optional<std::reference_wrapper<Quest>> getActiveQuest() {
-		std::string questName = activeQuest;
+		if (activeQuestIndex != std::nullopt) {
+			return quests[*activeQuestIndex];
+		} else {
+			UE_LOG(LogQuesto, Verbose, TEXT("Active quest %s not found"), UTF8_TO_TCHAR(activeQuest.c_str()));
+			return std::nullopt;
+		}
+	}
+	
+	// Resolves the active quest, its active stage and that stage's active sub-stage from tracked positions.
+	// Returns nullptr if any link of the chain is missing
+	SubStage* getActiveSubStage() {
+		if (activeQuestIndex == std::nullopt) {
+			return nullptr;
+		}
 		
-		std::string lowerCaseName = QuestoUtil::getLowerCase(questName);
+		Quest& quest = quests[*activeQuestIndex];
+		std::optional<size_t> stageIndex = quest.getActiveStageIndex();
+		if (stageIndex == std::nullopt) {
+			return nullptr;
+		}
 		
-		// Find the quest based on the lowercase name
-		auto it = std::find_if(quests.begin(), quests.end(),
-							   [&lowerCaseName](const Quest& q) { return q.getLowerCaseName() == lowerCaseName; });
+		Stage& stage = quest.getStageAt(*stageIndex);
+		std::optional<size_t> subStageIndex = stage.getActiveSubStageIndex();
+		if (subStageIndex == std::nullopt) {
+			return nullptr;
+		}
 		
-		if (it != quests.end()) {
-			return *it;
-		} else {
-			std::cout << "Quest not found" << std::endl;
-			return std::nullopt;
+		return &stage.getSubStageAt(*subStageIndex);
+	}
+	
+	std::optional<size_t> findQuestIndex(const std::string& questName) const {
+		auto it = QuestoUtil::lookup(questNameIndex, questName);
+		if (it != questNameIndex.end()) {
+			return it->second;
 		}
+		return std::nullopt;
+	}
+	
+	std::optional<size_t> getActiveQuestIndex() const {
+		return activeQuestIndex;
+	}
+	
+	size_t getQuestCount() const {
+		return quests.size();
+	}
+	
+	Quest& getQuestAt(size_t questPosition) {
+		return quests[questPosition];
+	}
+	
+	uint32_t getGeneration() const {
+		return generation;
 	}
 	
 	// Function to get a quest from the system
 	std::optional<std::reference_wrapper<Quest>> getQuest(const std::string& questName) {
-		std::string lowerCaseName = QuestoUtil::getLowerCase(questName);
-
-		// Find the quest based on the lowercase name
-		auto it = std::find_if(quests.begin(), quests.end(),
-							   [&lowerCaseName](const Quest& q) { return q.getLowerCaseName() == lowerCaseName; });
+		// Find the quest through the case-insensitive index
+		auto it = QuestoUtil::lookup(questNameIndex, questName);
 		
-		if (it != quests.end()) {
-			return *it;
+		if (it != questNameIndex.end()) {
+			return quests[it->second];
 		} else {
-			std::cout << "Quest not found" << std::endl;
+			UE_LOG(LogQuesto, Verbose, TEXT("Quest %s not found"), UTF8_TO_TCHAR(questName.c_str()));
 			return std::nullopt;
 		}
 	}
 	
+	// Appends a versioned binary snapshot of the whole quest graph to outData
+	void saveSnapshot(std::vector<unsigned char>& outData) const {
+		QuestoUtil::ByteWriter writer(outData);
+		writer.write<uint32_t>(QuestoUtil::SnapshotMagic);
+		writer.write<uint32_t>(QuestoUtil::SnapshotVersion);
+		writer.writeString(activeQuest);
+		writer.write<uint32_t>(static_cast<uint32_t>(quests.size()));
+		for (const Quest& quest : quests) {
+			quest.save(writer);
+		}
+	}
+	
+	// Replaces the quest graph with the snapshot in data. The current state is kept if the snapshot is invalid
+	bool loadSnapshot(const unsigned char* data, size_t size) {
+		QuestoUtil::ByteReader reader(data, size);
+		
+		uint32_t magic = 0;
+		uint32_t version = 0;
+		if (!reader.read(magic) || magic != QuestoUtil::SnapshotMagic) {
+			UE_LOG(LogQuesto, Warning, TEXT("Invalid quest snapshot header"));
+			return false;
+		}
+		if (!reader.read(version) || version != QuestoUtil::SnapshotVersion) {
+			UE_LOG(LogQuesto, Warning, TEXT("Unsupported quest snapshot version %u"), version);
+			return false;
+		}
+		
+		std::string loadedActiveQuest;
+		uint32_t questCount = 0;
+		if (!reader.readString(loadedActiveQuest) || !reader.readCount(questCount)) {
+			UE_LOG(LogQuesto, Warning, TEXT("Corrupted quest snapshot"));
+			return false;
+		}
+		
+		std::vector<Quest> loadedQuests;
+		loadedQuests.reserve(questCount);
+		for (uint32_t i = 0; i < questCount; ++i) {
+			Quest quest("", {});
+			if (!quest.load(reader)) {
+				UE_LOG(LogQuesto, Warning, TEXT("Corrupted quest snapshot at quest %u"), i);
+				return false;
+			}
+			loadedQuests.push_back(std::move(quest));
+		}
+		
+		quests = std::move(loadedQuests);
+		activeQuest = std::move(loadedActiveQuest);
+		questNameIndex.clear();
+		questNameIndex.reserve(quests.size());
+		for (size_t i = 0; i < quests.size(); ++i) {
+			questNameIndex.emplace(quests[i].getName(), i);
+		}
+		activeQuestIndex = findQuestIndex(activeQuest);
+		++generation;
+		return true;
+	}
+	
 private:
 	// Function to add a quest to the system
 	void addQuest(const Quest& quest) {
 		quests.push_back(quest);
+		questNameIndex.emplace(quest.getName(), quests.size() - 1);
+		
+		// The active quest may name a quest that did not exist yet, e.g. after loading a snapshot
+		if (activeQuestIndex == std::nullopt && QuestoUtil::CaseInsensitiveEqual()(activeQuest, quest.getName())) {
+			activeQuestIndex = quests.size() - 1;
+		}
 	}
 };
+
+namespace QuestoUtil {
+
+// Lock helpers for handles that may not be bound to a quest system yet
+inline QuestSystem::ReadLock readLock(const QuestSystem* questSystem) {
+	return questSystem != nullptr ? questSystem->readLock() : QuestSystem::ReadLock();
+}
+
+inline QuestSystem::WriteLock writeLock(const QuestSystem* questSystem) {
+	return questSystem != nullptr ? questSystem->writeLock() : QuestSystem::WriteLock();
+}
+
+}
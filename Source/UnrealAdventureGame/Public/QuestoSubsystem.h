@@ -30,6 +30,14 @@ public:
 	// Called when the game ends
 	virtual void Deinitialize() override;
 	
+	// Direct access for C++ callers, e.g. worker threads that prebuild quests. Hold the quest system's read or write lock
+	// while using it once concurrent access is enabled
+	QuestSystem& GetQuestSystem();
+	
+	// Enables locking of the quest system so it can be used from worker threads alongside the game thread
+	UFUNCTION(BlueprintCallable, Category = "Quest")
+	void SetConcurrentAccessEnabled(bool bEnabled);
+	
 	// Blueprint callable function for branching in Blueprints
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	bool GetOrCreateQuest(const FString& QuestName, UPARAM(ref) UUnrealQuest*& OutUnrealQuest);
@@ -40,6 +48,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	bool GetActiveQuest(UPARAM(ref) UUnrealQuest*& OutUnrealQuest);
 
+	// Resolves the active sub-stage of the active stage of the active quest in one call
+	UFUNCTION(BlueprintCallable, Category = "Quest")
+	bool GetActiveSubStage(UPARAM(ref) UUnrealSubStage*& OutUnrealSubStage);
+
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	void SetActiveQuest(const FString& QuestName);
 
@@ -55,7 +67,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	void AppendGibberishForCharacter(const FString& character, const FString& id, const TArray<uint8>& gibberish);
 
+	// Writes the whole quest graph, including dialog audio, as a binary snapshot. Kept impure despite being const, so it runs once per exec pin
+	UFUNCTION(BlueprintCallable, Category = "Quest|Snapshot", meta = (BlueprintPure = false))
+	bool SaveSnapshotToBuffer(TArray<uint8>& OutSnapshot) const;
+
+	// Replaces the quest graph with a snapshot previously written by SaveSnapshotToBuffer
+	UFUNCTION(BlueprintCallable, Category = "Quest|Snapshot")
+	bool LoadSnapshotFromBuffer(const TArray<uint8>& Snapshot);
+
+	UFUNCTION(BlueprintCallable, Category = "Quest|Snapshot", meta = (BlueprintPure = false))
+	bool SaveSnapshotToFile(const FString& FilePath) const;
+
+	// Loads a snapshot file. The file is memory-mapped when the platform supports it, otherwise it is read into memory
+	UFUNCTION(BlueprintCallable, Category = "Quest|Snapshot")
+	bool LoadSnapshotFromFile(const FString& FilePath);
+
 
 private:
+	// Returns the cached wrapper for the quest at QuestIndex, creating it on first use. Safe under the quest system's read lock
+	UUnrealQuest* GetQuestWrapper(size_t QuestIndex);
+	
 	QuestSystem mQuestSystem;
+	
+	// Wrappers indexed like the quest system's quests, so repeated queries hand back the same object
+	UPROPERTY()
+	TArray<UUnrealQuest*> mQuestWrappers;
+	
+	// Serializes lazy wrapper creation, since several readers may hold the quest system's read lock at once. Resetting
+	// the cache happens under the write lock, which already excludes them
+	FCriticalSection mQuestWrappersGuard;
 };
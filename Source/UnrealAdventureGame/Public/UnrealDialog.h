@@ -9,6 +9,8 @@
 
 #include "UnrealDialog.generated.h"
 
+class UUnrealSubStage;
+
 UCLASS(BlueprintType)
 class UNREALADVENTUREGAME_API UUnrealDialog : public UObject
 {
@@ -21,20 +23,44 @@ public:
 	// Constructor that takes FObjectInitializer
 	UUnrealDialog(const FObjectInitializer& ObjectInitializer);
 	
-	// Function to initialize the quest with QuestSystem
-	void Initialize(Dialog& dialog);
+	// Binds the wrapper to the dialog of a character inside the owning sub-stage
+	void Initialize(UUnrealSubStage* ownerSubStage, const FString& characterId);
+	
+	// Returns the bound dialog, or nullptr if the owning sub-stage can no longer be resolved
+	Dialog* ResolveDialog() const;
+	
+	QuestSystem* GetQuestSystem() const;
 	
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	FString GetString();
 	
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	TArray<uint8> GetGibberish();
+	
+	UFUNCTION(BlueprintPure, Category = "Quest")
+	int32 GetGibberishCount();
+	
+	UFUNCTION(BlueprintCallable, Category = "Quest")
+	TArray<uint8> GetGibberishAt(int32 Index);
+	
+	// Returns a random gibberish clip without copying it. The view is only valid until the dialog's gibberish is modified.
+	// These do not lock: with concurrent access enabled, hold the quest system's read lock for as long as the view is used
+	TArrayView<const uint8> GetGibberishView();
+	
+	// Returns the gibberish clip at Index without copying it. Same lifetime and locking rules as GetGibberishView
+	TArrayView<const uint8> GetGibberishViewAt(int32 Index);
 
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Quest")
 	FString CharacterId;
 
 private:
-	Dialog* mDialog;  // Use a pointer to avoid issues with UObject constructors
+	// Looks up a clip without locking. INDEX_NONE picks a random clip
+	TArrayView<const uint8> FindGibberishView(int32 Index);
+	
+	UPROPERTY()
+	UUnrealSubStage* mOwnerSubStage = nullptr;
+	
+	std::string mCharacterId;
 };
 
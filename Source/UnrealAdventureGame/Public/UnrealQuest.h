@@ -26,7 +26,13 @@ public:
 	// Constructor that takes FObjectInitializer
 	UUnrealQuest(const FObjectInitializer& ObjectInitializer);
 	
-	void Initialize(Quest& quest);
+	// Binds the wrapper to a quest by its position in the quest system
+	void Initialize(QuestSystem& questSystem, size_t questIndex);
+	
+	// Returns the bound quest, or nullptr if the quest system was reloaded since this wrapper was created
+	Quest* ResolveQuest() const;
+	
+	QuestSystem* GetQuestSystem() const;
 	
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	bool GetOrCreateStage(const FString& StageName, UPARAM(ref) UUnrealStage*& OutUnrealStage);
@@ -37,9 +43,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	bool GetActiveStage(UPARAM(ref) UUnrealStage*& OutUnrealStage);
 	
+	// Returns the cached wrapper for the stage at StageIndex, creating it on first use. Safe under the quest system's read lock,
+	// which must be held while quest is used
+	UUnrealStage* GetStageWrapper(Quest& quest, size_t StageIndex);
+	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Quest")
 	FString Name;
 	
 private:
-	Quest* mQuest;  // Use a pointer to avoid issues with UObject constructors
+	// Handles stay valid as the quest graph grows because entries are only ever appended
+	QuestSystem* mQuestSystem = nullptr;  // Use a pointer to avoid issues with UObject constructors
+	size_t mQuestIndex = 0;
+	uint32_t mGeneration = 0;
+	
+	UPROPERTY()
+	TArray<UUnrealStage*> mStageWrappers;
+	
+	// Serializes lazy wrapper creation, since several readers may hold the quest system's read lock at once
+	FCriticalSection mStageWrappersGuard;
 };
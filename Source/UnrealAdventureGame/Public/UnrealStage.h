@@ -11,6 +11,8 @@
 
 #include "UnrealStage.generated.h"
 
+class UUnrealQuest;
+
 UCLASS(BlueprintType)
 class UNREALADVENTUREGAME_API UUnrealStage : public UObject
 {
@@ -23,8 +25,13 @@ public:
 	// Constructor that takes FObjectInitializer
 	UUnrealStage(const FObjectInitializer& ObjectInitializer);
 	
-	// Function to initialize the quest with QuestSystem
-	void Initialize(Stage& stage);
+	// Binds the wrapper to a stage by its position in the owning quest
+	void Initialize(UUnrealQuest* ownerQuest, size_t stageIndex);
+	
+	// Returns the bound stage, or nullptr if the owning quest can no longer be resolved
+	Stage* ResolveStage() const;
+	
+	QuestSystem* GetQuestSystem() const;
 	
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	bool GetOrCreateSubStage(const FString& SubStageName, UPARAM(ref) UUnrealSubStage*& OutUnrealSubStage);
@@ -38,9 +45,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	void CompleteSubStage(const FString& SubStageName);
 
+	// Returns the cached wrapper for the sub-stage at SubStageIndex, creating it on first use. Safe under the quest system's read lock,
+	// which must be held while stage is used
+	UUnrealSubStage* GetSubStageWrapper(Stage& stage, size_t SubStageIndex);
+	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Quest")
 	FString Name;
 	
 private:
-	Stage* mStage;  // Use a pointer to avoid issues with UObject constructors
+	UPROPERTY()
+	UUnrealQuest* mOwnerQuest = nullptr;
+	
+	size_t mStageIndex = 0;
+	
+	UPROPERTY()
+	TArray<UUnrealSubStage*> mSubStageWrappers;
+	
+	// Serializes lazy wrapper creation, since several readers may hold the quest system's read lock at once
+	FCriticalSection mSubStageWrappersGuard;
 };
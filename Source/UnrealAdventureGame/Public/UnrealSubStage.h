@@ -10,6 +10,8 @@
 
 #include "UnrealSubStage.generated.h"
 
+class UUnrealStage;
+
 UCLASS(BlueprintType)
 class UNREALADVENTUREGAME_API UUnrealSubStage : public UObject
 {
@@ -22,8 +24,13 @@ public:
 	// Constructor that takes FObjectInitializer
 	UUnrealSubStage(const FObjectInitializer& ObjectInitializer);
 	
-	// Function to initialize the quest with QuestSystem
-	void Initialize(SubStage& stage);
+	// Binds the wrapper to a sub-stage by its position in the owning stage
+	void Initialize(UUnrealStage* ownerStage, size_t subStageIndex);
+	
+	// Returns the bound sub-stage, or nullptr if the owning stage can no longer be resolved
+	SubStage* ResolveSubStage() const;
+	
+	QuestSystem* GetQuestSystem() const;
 	
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	void ClearGibberishForCharacter(const FString& Id);
@@ -41,6 +48,19 @@ public:
 	FString Name;
 	
 private:
-	SubStage* mSubStage;  // Use a pointer to avoid issues with UObject constructors
+	// Returns the cached wrapper for the dialog of the character, or nullptr. Should only be used while mDialogWrappersGuard is held
+	UUnrealDialog* FindDialogWrapper(const FString& Id) const;
+	
+	UPROPERTY()
+	UUnrealStage* mOwnerStage = nullptr;
+	
+	size_t mSubStageIndex = 0;
+	
+	// Dialog wrappers, one per character id
+	UPROPERTY()
+	TArray<UUnrealDialog*> mDialogWrappers;
+	
+	// Serializes the lookup and the creation of dialog wrappers, so concurrent callers share one wrapper per character id
+	FCriticalSection mDialogWrappersGuard;
 };
 
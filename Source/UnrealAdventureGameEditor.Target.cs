@@ -10,7 +10,7 @@ public class UnrealAdventureGameEditorTarget : TargetRules
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V4;
 
-		ExtraModuleNames.AddRange( new string[] { "UnrealAdventureGame" } );
+		ExtraModuleNames.AddRange( new string[] { "UnrealAdventureGame", "UnrealAdventureGameTests" } );
 
 		bCompileAgainstEngine = true;
 
@@ -0,0 +1,154 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Questo.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr int32 NumQuests = 1000;
+	constexpr int32 NumIterations = 100000;
+	constexpr int32 NumStagesPerQuest = 4;
+	constexpr int32 NumSubStagesPerStage = 4;
+	constexpr int32 NumGibberishClips = 16;
+	constexpr int32 GibberishClipSize = 16 * 1024;
+
+	// Regression thresholds. They leave an order of magnitude of headroom over a development build on a desktop CPU, so
+	// only algorithmic regressions (e.g. lookups scanning the quest graph again) trip them
+	constexpr double MaxBuildNanosecondsPerEntry = 5000;
+	constexpr double MaxLookupNanoseconds = 2000;
+	constexpr double MaxActiveChainNanoseconds = 500;
+	constexpr double MaxGibberishPickNanoseconds = 1000;
+	constexpr double MaxSnapshotMilliseconds = 100;
+
+	// Keeps the optimiser from discarding the measured work
+	volatile size_t GQuestoBenchmarkSink = 0;
+
+	double NanosecondsPerOperation(double Seconds, int32 NumOperations)
+	{
+		return Seconds * 1e9 / FMath::Max(NumOperations, 1);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestoPerformanceTest, "UnrealAdventureGame.Questo.Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FQuestoPerformanceTest::RunTest(const FString& Parameters)
+{
+	QuestSystem Quests;
+	size_t Sink = 0;
+
+	auto CheckThreshold = [this](const TCHAR* Name, double Measured, double Threshold, const TCHAR* Unit)
+	{
+		AddInfo(FString::Printf(TEXT("%s: %.1f %s (threshold %.1f %s)"), Name, Measured, Unit, Threshold, Unit));
+		if (Measured > Threshold)
+		{
+			AddError(FString::Printf(TEXT("%s took %.1f %s, above the threshold of %.1f %s"), Name, Measured, Unit, Threshold, Unit));
+		}
+	};
+
+	// Names are prepared up front so the timings only cover the quest system itself
+	std::vector<std::string> QuestNames;
+	std::vector<std::string> LookupNames;
+	QuestNames.reserve(NumQuests);
+	LookupNames.reserve(NumQuests);
+	for (int32 QuestIndex = 0; QuestIndex < NumQuests; ++QuestIndex)
+	{
+		QuestNames.push_back("quest_" + std::to_string(QuestIndex));
+		LookupNames.push_back("QUEST_" + std::to_string(QuestIndex));
+	}
+
+	std::vector<std::string> StageNames;
+	for (int32 StageIndex = 0; StageIndex < FMath::Max(NumStagesPerQuest, NumSubStagesPerStage); ++StageIndex)
+	{
+		StageNames.push_back("stage_" + std::to_string(StageIndex));
+	}
+
+	// Build the quest graph
+	double StartTime = FPlatformTime::Seconds();
+	for (const std::string& QuestName : QuestNames)
+	{
+		Quests.createEmptyQuest(QuestName);
+		Quest& NewQuest = Quests.getQuestAt(*Quests.findQuestIndex(QuestName));
+		for (int32 StageIndex = 0; StageIndex < NumStagesPerQuest; ++StageIndex)
+		{
+			NewQuest.createEmptyStage(StageNames[StageIndex]);
+			Stage& NewStage = NewQuest.getStageAt(StageIndex);
+			for (int32 SubStageIndex = 0; SubStageIndex < NumSubStagesPerStage; ++SubStageIndex)
+			{
+				NewStage.createEmptySubStage(StageNames[SubStageIndex]);
+			}
+		}
+	}
+	const double BuildTime = FPlatformTime::Seconds() - StartTime;
+
+	// Case-insensitive lookups
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Sink += Quests.findQuestIndex(LookupNames[Iteration % NumQuests]).value_or(0);
+	}
+	const double LookupTime = FPlatformTime::Seconds() - StartTime;
+
+	// Active quest -> stage -> sub-stage resolution
+	Quests.setActiveQuest(LookupNames.back());
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Sink += reinterpret_cast<size_t>(Quests.getActiveSubStage());
+	}
+	const double ActiveChainTime = FPlatformTime::Seconds() - StartTime;
+
+	// Random gibberish retrieval
+	SubStage* ActiveSubStage = Quests.getActiveSubStage();
+	if (!TestNotNull(TEXT("The active quest resolves to a sub-stage"), ActiveSubStage))
+	{
+		return false;
+	}
+
+	Dialog* BenchmarkDialog = nullptr;
+	ActiveSubStage->getDialog("benchmark", &BenchmarkDialog);
+	for (int32 ClipIndex = 0; ClipIndex < NumGibberishClips; ++ClipIndex)
+	{
+		BenchmarkDialog->appendGibberish("clip_" + std::to_string(ClipIndex), std::vector<unsigned char>(GibberishClipSize, static_cast<unsigned char>(ClipIndex)));
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Sink += BenchmarkDialog->getRandomGibberishView().size;
+	}
+	const double GibberishTime = FPlatformTime::Seconds() - StartTime;
+
+	// Snapshot round trip
+	std::vector<unsigned char> Snapshot;
+	StartTime = FPlatformTime::Seconds();
+	Quests.saveSnapshot(Snapshot);
+	const double SaveTime = FPlatformTime::Seconds() - StartTime;
+
+	QuestSystem LoadedQuests;
+	StartTime = FPlatformTime::Seconds();
+	const bool bLoaded = LoadedQuests.loadSnapshot(Snapshot.data(), Snapshot.size());
+	const double LoadTime = FPlatformTime::Seconds() - StartTime;
+
+	GQuestoBenchmarkSink = Sink;
+
+	const int32 NumEntries = NumQuests * (1 + NumStagesPerQuest * (1 + NumSubStagesPerStage));
+	AddInfo(FString::Printf(TEXT("%d quests, %d iterations, %.2f MB snapshot"), NumQuests, NumIterations, Snapshot.size() / (1024.0 * 1024.0)));
+
+	CheckThreshold(TEXT("Build"), NanosecondsPerOperation(BuildTime, NumEntries), MaxBuildNanosecondsPerEntry, TEXT("ns per entry"));
+	CheckThreshold(TEXT("Quest lookup"), NanosecondsPerOperation(LookupTime, NumIterations), MaxLookupNanoseconds, TEXT("ns/op"));
+	CheckThreshold(TEXT("Active chain"), NanosecondsPerOperation(ActiveChainTime, NumIterations), MaxActiveChainNanoseconds, TEXT("ns/op"));
+	CheckThreshold(TEXT("Gibberish pick"), NanosecondsPerOperation(GibberishTime, NumIterations), MaxGibberishPickNanoseconds, TEXT("ns/op"));
+	CheckThreshold(TEXT("Snapshot save"), SaveTime * 1000, MaxSnapshotMilliseconds, TEXT("ms"));
+	CheckThreshold(TEXT("Snapshot load"), LoadTime * 1000, MaxSnapshotMilliseconds, TEXT("ms"));
+
+	TestTrue(TEXT("The snapshot loads back"), bLoaded);
+	TestEqual(TEXT("The loaded snapshot holds every quest"), static_cast<int32>(LoadedQuests.getQuestCount()), static_cast<int32>(Quests.getQuestCount()));
+
+	return true;
+}
+
+#endif
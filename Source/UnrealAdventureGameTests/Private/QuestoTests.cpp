@@ -0,0 +1,167 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Questo.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Builds a quest with the given stages, each holding the same sub-stages
+	void CreateQuest(QuestSystem& Quests, const std::string& QuestName, const std::vector<std::string>& StageNames, const std::vector<std::string>& SubStageNames)
+	{
+		Quests.createEmptyQuest(QuestName);
+		Quest& NewQuest = Quests.getQuestAt(*Quests.findQuestIndex(QuestName));
+		for (const std::string& StageName : StageNames)
+		{
+			NewQuest.createEmptyStage(StageName);
+			Stage& NewStage = NewQuest.getStageAt(*NewQuest.findStageIndex(StageName));
+			for (const std::string& SubStageName : SubStageNames)
+			{
+				NewStage.createEmptySubStage(SubStageName);
+			}
+		}
+	}
+
+	bool ViewEquals(const Dialog::GibberishView& View, const std::vector<unsigned char>& Expected)
+	{
+		return View.size == Expected.size() && std::equal(Expected.begin(), Expected.end(), View.data);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestoLookupTest, "UnrealAdventureGame.Questo.Lookup", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FQuestoLookupTest::RunTest(const FString& Parameters)
+{
+	QuestSystem Quests;
+
+	TestTrue(TEXT("Creating a new quest succeeds"), Quests.createEmptyQuest("Forest_Temple"));
+	TestFalse(TEXT("Creating a quest that differs only in case is a no-op"), Quests.createEmptyQuest("FOREST_TEMPLE"));
+
+	const std::optional<size_t> QuestIndex = Quests.findQuestIndex("forest_TEMPLE");
+	if (!TestTrue(TEXT("Lookups ignore case"), QuestIndex.has_value()))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Quest names are stored in lower case"), FString(UTF8_TO_TCHAR(Quests.getQuestAt(*QuestIndex).getName().c_str())), FString(TEXT("forest_temple")));
+	TestFalse(TEXT("Looking up a missing quest finds nothing"), Quests.findQuestIndex("desert_temple").has_value());
+	TestEqual(TEXT("The predefined quest and the new one are listed"), static_cast<int32>(Quests.getQuestCount()), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestoActiveChainTest, "UnrealAdventureGame.Questo.ActiveChain", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FQuestoActiveChainTest::RunTest(const FString& Parameters)
+{
+	QuestSystem Quests;
+	TestNotNull(TEXT("The predefined main quest resolves to a sub-stage"), Quests.getActiveSubStage());
+
+	CreateQuest(Quests, "village", {"arrival", "market"}, {"talk", "trade"});
+	Quests.setActiveQuest("VILLAGE");
+	TestTrue(TEXT("Activating a quest tracks its position"), Quests.getActiveQuestIndex() == Quests.findQuestIndex("village"));
+
+	SubStage* ActiveSubStage = Quests.getActiveSubStage();
+	if (!TestNotNull(TEXT("The active quest resolves to a sub-stage"), ActiveSubStage))
+	{
+		return false;
+	}
+
+	Quest& Village = Quests.getQuestAt(*Quests.findQuestIndex("village"));
+	Stage& Arrival = Village.getStageAt(*Village.findStageIndex("arrival"));
+	TestTrue(TEXT("The chain resolves to the first sub-stage of the first stage"), ActiveSubStage == &Arrival.getSubStageAt(0));
+
+	ActiveSubStage->complete();
+	TestTrue(TEXT("Completing the active sub-stage moves the chain to the next one"), Quests.getActiveSubStage() == &Arrival.getSubStageAt(1));
+
+	Quests.setActiveQuest("missing");
+	TestTrue(TEXT("Activating a missing quest keeps the active one"), Quests.getActiveQuestIndex() == Quests.findQuestIndex("village"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestoGibberishTest, "UnrealAdventureGame.Questo.Gibberish", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FQuestoGibberishTest::RunTest(const FString& Parameters)
+{
+	Dialog TestDialog("", {});
+	TestTrue(TEXT("A dialog without clips returns an empty view"), TestDialog.getRandomGibberishView().empty());
+
+	const std::vector<unsigned char> FirstClip(64, 1);
+	const std::vector<unsigned char> SecondClip(128, 2);
+	const std::vector<unsigned char> ReplacedClip(32, 3);
+
+	TestDialog.appendGibberish("first", FirstClip);
+	TestDialog.appendGibberish("second", SecondClip);
+	TestEqual(TEXT("Both clips are stored"), static_cast<int32>(TestDialog.getGibberishCount()), 2);
+	TestTrue(TEXT("The first clip is returned unchanged"), ViewEquals(TestDialog.getGibberishView(0), FirstClip));
+	TestTrue(TEXT("The second clip is returned unchanged"), ViewEquals(TestDialog.getGibberishView(1), SecondClip));
+
+	TestDialog.appendGibberish("first", ReplacedClip);
+	TestEqual(TEXT("Replacing a clip keeps the clip count"), static_cast<int32>(TestDialog.getGibberishCount()), 2);
+	TestTrue(TEXT("A replaced clip returns the new data"), ViewEquals(TestDialog.getGibberishView(0), ReplacedClip));
+	TestTrue(TEXT("Replacing a clip leaves the others intact"), ViewEquals(TestDialog.getGibberishView(1), SecondClip));
+	TestTrue(TEXT("Positions past the last clip return an empty view"), TestDialog.getGibberishView(2).empty());
+
+	for (int32 Pick = 0; Pick < 16; ++Pick)
+	{
+		const Dialog::GibberishView View = TestDialog.getRandomGibberishView();
+		if (!ViewEquals(View, ReplacedClip) && !ViewEquals(View, SecondClip))
+		{
+			AddError(TEXT("A random pick returned data that does not match any clip"));
+			break;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestoSnapshotTest, "UnrealAdventureGame.Questo.Snapshot", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FQuestoSnapshotTest::RunTest(const FString& Parameters)
+{
+	QuestSystem Quests;
+	CreateQuest(Quests, "castle", {"gate", "keep"}, {"guard", "lord"});
+	Quests.setActiveQuest("castle");
+
+	const std::vector<unsigned char> Clip(256, 7);
+	Dialog* GuardDialog = nullptr;
+	Quests.getActiveSubStage()->getDialog("guard", &GuardDialog);
+	GuardDialog->setString("Halt!");
+	GuardDialog->appendGibberish("halt", Clip);
+
+	std::vector<unsigned char> Snapshot;
+	Quests.saveSnapshot(Snapshot);
+
+	QuestSystem LoadedQuests;
+	const uint32_t Generation = LoadedQuests.getGeneration();
+	if (!TestTrue(TEXT("A saved snapshot loads"), LoadedQuests.loadSnapshot(Snapshot.data(), Snapshot.size())))
+	{
+		return false;
+	}
+
+	TestNotEqual(TEXT("Loading bumps the generation"), LoadedQuests.getGeneration(), Generation);
+	TestEqual(TEXT("All quests are restored"), static_cast<int32>(LoadedQuests.getQuestCount()), static_cast<int32>(Quests.getQuestCount()));
+	TestTrue(TEXT("The active quest is restored"), LoadedQuests.getActiveQuestIndex() == LoadedQuests.findQuestIndex("castle"));
+
+	SubStage* LoadedSubStage = LoadedQuests.getActiveSubStage();
+	Dialog* LoadedDialog = LoadedSubStage != nullptr ? LoadedSubStage->findDialog("guard") : nullptr;
+	if (!TestNotNull(TEXT("The dialog is restored"), LoadedDialog))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("The dialog content is restored"), FString(UTF8_TO_TCHAR(LoadedDialog->getString().c_str())), FString(TEXT("Halt!")));
+	TestTrue(TEXT("The dialog audio is restored"), LoadedDialog->getGibberishCount() == 1 && ViewEquals(LoadedDialog->getGibberishView(0), Clip));
+
+	// A truncated snapshot must be rejected without touching the current state
+	AddExpectedError(TEXT("Corrupted quest snapshot"), EAutomationExpectedErrorFlags::Contains, 0);
+	TestFalse(TEXT("A truncated snapshot is rejected"), LoadedQuests.loadSnapshot(Snapshot.data(), Snapshot.size() / 2));
+	TestEqual(TEXT("A rejected snapshot keeps the current quests"), static_cast<int32>(LoadedQuests.getQuestCount()), static_cast<int32>(Quests.getQuestCount()));
+
+	return true;
+}
+
+#endif
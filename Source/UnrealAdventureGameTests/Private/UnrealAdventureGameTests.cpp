@@ -0,0 +1,6 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Modules/ModuleManager.h"
+
+// Automation tests only, run them with: -nullrhi -ExecCmds="Automation RunTests UnrealAdventureGame; Quit"
+IMPLEMENT_MODULE(FDefaultModuleImpl, UnrealAdventureGameTests);